@@ -0,0 +1,175 @@
+// Batched Hash Table Lookups with Software Prefetching
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+
+#define GROUP_SIZE 32   // Lookups kept in flight together
+
+struct Node {
+    int key;
+    int value;
+    struct Node* next;
+};
+
+struct HashTable {
+    struct Node** buckets;
+    size_t size;
+};
+
+struct HashTable* createTable(size_t size) {
+    struct HashTable* table = (struct HashTable*)malloc(sizeof(struct HashTable));
+    table->buckets = (struct Node**)calloc(size, sizeof(struct Node*));
+    table->size = size;
+    return table;
+}
+
+size_t hashFunction(const struct HashTable* table, int key) {
+    return (size_t)(((uint64_t)(uint32_t)key * 11400714819323198485ull) >> 32) % table->size;
+}
+
+void insertNode(struct HashTable* table, struct Node* newNode, int key, int value) {
+    size_t index = hashFunction(table, key);
+    newNode->key = key;
+    newNode->value = value;
+    newNode->next = table->buckets[index];
+    table->buckets[index] = newNode;
+}
+
+int search(const struct HashTable* table, int key) {
+    struct Node* temp = table->buckets[hashFunction(table, key)];
+
+    while (temp != NULL) {
+        if (temp->key == key) {
+            return temp->value;
+        }
+        temp = temp->next;
+    }
+
+    return -1;
+}
+
+// Group prefetching: every stage issues the loads for the whole group
+// before using any of them, so up to GROUP_SIZE cache misses overlap.
+// out[i] receives the value for keys[i], or -1.
+void searchBatch(const struct HashTable* table, const int keys[], size_t n, int out[]) {
+    struct Node** heads[GROUP_SIZE];
+    struct Node* cursor[GROUP_SIZE];
+
+    for (size_t base = 0; base < n; base += GROUP_SIZE) {
+        int count = n - base < GROUP_SIZE ? (int)(n - base) : GROUP_SIZE;
+
+        // Stage 1: hash and prefetch bucket heads
+        for (int i = 0; i < count; i++) {
+            heads[i] = &table->buckets[hashFunction(table, keys[base + i])];
+            __builtin_prefetch(heads[i]);
+        }
+
+        // Stage 2: load heads and prefetch first nodes
+        for (int i = 0; i < count; i++) {
+            cursor[i] = *heads[i];
+            out[base + i] = -1;
+            if (cursor[i] != NULL) __builtin_prefetch(cursor[i]);
+        }
+
+        // Stage 3: advance every unfinished chain one node per round
+        int active = count;
+        while (active > 0) {
+            active = 0;
+            for (int i = 0; i < count; i++) {
+                struct Node* node = cursor[i];
+                if (node == NULL) continue;
+
+                if (node->key == keys[base + i]) {
+                    out[base + i] = node->value;
+                    cursor[i] = NULL;
+                } else {
+                    cursor[i] = node->next;
+                    if (cursor[i] != NULL) {
+                        __builtin_prefetch(cursor[i]);
+                        active++;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void destroyTable(struct HashTable* table) {
+    free(table->buckets);
+    free(table);
+}
+
+// ---------- benchmark on a table larger than the last-level cache ----------
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t nextRandom(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+int main(int argc, char* argv[]) {
+    struct HashTable* small = createTable(10);
+    struct Node demoNodes[5];
+    int demoKeys[] = {1, 11, 21, 2, 12};
+    for (int i = 0; i < 5; i++) insertNode(small, &demoNodes[i], demoKeys[i], (i + 1) * 10);
+
+    int queries[] = {11, 25, 2, 12};
+    int results[4];
+    searchBatch(small, queries, 4, results);
+    for (int i = 0; i < 4; i++) printf("Search key %d: %d\n", queries[i], results[i]);
+    destroyTable(small);
+
+    size_t n = argc > 1 ? (size_t)atol(argv[1]) : 8000000;
+    if (n == 0) n = 1;
+    struct HashTable* table = createTable(n);
+    struct Node* pool = (struct Node*)malloc(n * sizeof(struct Node));
+    int* keys = (int*)malloc(n * sizeof(int));
+    int* out = (int*)malloc(n * sizeof(int));
+    uint32_t state = 2463534242u;
+
+    // Nodes are taken from the pool in random order so chains scatter like malloc'd nodes
+    size_t* order = (size_t*)malloc(n * sizeof(size_t));
+    for (size_t i = 0; i < n; i++) order[i] = i;
+    for (size_t i = n - 1; i > 0; i--) {
+        size_t j = nextRandom(&state) % (i + 1);
+        size_t t = order[i]; order[i] = order[j]; order[j] = t;
+    }
+    for (size_t i = 0; i < n; i++) {
+        keys[i] = (int)nextRandom(&state);
+        insertNode(table, &pool[order[i]], keys[i], (int)i);
+    }
+    free(order);
+
+    // Query half hits, half misses, in random order
+    for (size_t i = 0; i < n; i++) {
+        keys[i] = (i & 1) ? keys[i + nextRandom(&state) % (n - i)] : (int)nextRandom(&state);
+    }
+
+    long checksum = 0;
+    double t0 = nowSeconds();
+    for (size_t i = 0; i < n; i++) checksum += search(table, keys[i]);
+    double t1 = nowSeconds();
+    searchBatch(table, keys, n, out);
+    double t2 = nowSeconds();
+    for (size_t i = 0; i < n; i++) checksum -= out[i];
+
+    printf("\n%zu keys, table ~%zu MB\n", n, (n * (sizeof(struct Node) + sizeof(struct Node*))) >> 20);
+    printf("search loop   %8.1f ns/lookup\n", (t1 - t0) * 1e9 / n);
+    printf("searchBatch   %8.1f ns/lookup\n", (t2 - t1) * 1e9 / n);
+    printf("results %s\n", checksum == 0 ? "match" : "MISMATCH");
+
+    free(pool);
+    free(keys);
+    free(out);
+    destroyTable(table);
+    return 0;
+}
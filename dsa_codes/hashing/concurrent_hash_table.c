@@ -0,0 +1,329 @@
+// Concurrent Hash Table (lock-free reads, striped-lock writes, epoch reclamation)
+// Build: gcc -O2 -pthread concurrent_hash_table.c
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+
+#define NUM_STRIPES 64     // Writer locks; bucket i uses stripe i % NUM_STRIPES
+#define MAX_THREADS 64
+#define RETIRE_BATCH 64    // Retired nodes collected before trying to advance the epoch
+
+struct Node {
+    int key;
+    _Atomic int value;
+    _Atomic(struct Node*) next;
+    struct Node* retiredNext;   // Limbo link; next must stay intact for readers
+};
+
+// ---------- epoch-based reclamation ----------
+//
+// A reader announces the global epoch it saw before touching any node.
+// A node unlinked while the global epoch was G can only be reached by
+// readers that announced G or earlier, so it is freed once the global
+// epoch reaches G + 2 (every active thread has announced G + 1 since).
+
+struct LimboList {
+    struct Node* head;
+    unsigned long epoch;
+};
+
+struct ThreadRecord {
+    _Atomic unsigned long announce;   // (epoch << 1) | active
+    struct LimboList limbo[3];
+    int retiredSinceAdvance;
+    char pad[64];
+};
+
+static _Atomic unsigned long globalEpoch = 2;
+static struct ThreadRecord records[MAX_THREADS];
+static _Atomic int registeredThreads = 0;
+
+// Each thread's id indexes records[]; running out of slots is a bug in
+// the caller, so stop rather than corrupt a neighbour's record
+int registerThread() {
+    int id = atomic_fetch_add(&registeredThreads, 1);
+    if (id >= MAX_THREADS) {
+        fprintf(stderr, "registerThread: more than %d threads\n", MAX_THREADS);
+        abort();
+    }
+    return id;
+}
+
+static void freeLimbo(struct LimboList* list) {
+    struct Node* temp = list->head;
+    while (temp != NULL) {
+        struct Node* next = temp->retiredNext;
+        free(temp);
+        temp = next;
+    }
+    list->head = NULL;
+}
+
+static void tryAdvanceEpoch() {
+    unsigned long epoch = atomic_load(&globalEpoch);
+    int count = atomic_load(&registeredThreads);
+
+    for (int i = 0; i < count; i++) {
+        unsigned long announce = atomic_load(&records[i].announce);
+        if ((announce & 1) && (announce >> 1) != epoch) return;
+    }
+    atomic_compare_exchange_strong(&globalEpoch, &epoch, epoch + 1);
+}
+
+void enterEpoch(int tid) {
+    struct ThreadRecord* rec = &records[tid];
+    unsigned long epoch = atomic_load(&globalEpoch);
+
+    atomic_store(&rec->announce, (epoch << 1) | 1);
+    atomic_thread_fence(memory_order_seq_cst);
+
+    struct LimboList* safe = &rec->limbo[(epoch + 1) % 3];
+    if (safe->head != NULL && safe->epoch + 2 <= epoch) freeLimbo(safe);
+}
+
+void exitEpoch(int tid) {
+    atomic_store_explicit(&records[tid].announce, 0, memory_order_release);
+}
+
+// Called after the node is unlinked, inside the caller's epoch
+static void retireNode(int tid, struct Node* node) {
+    struct ThreadRecord* rec = &records[tid];
+    unsigned long epoch = atomic_load(&globalEpoch);
+    struct LimboList* list = &rec->limbo[epoch % 3];
+
+    if (list->epoch != epoch) {
+        freeLimbo(list);   // Holds nodes from epoch - 3 or earlier
+        list->epoch = epoch;
+    }
+    node->retiredNext = list->head;
+    list->head = node;
+
+    if (++rec->retiredSinceAdvance >= RETIRE_BATCH) {
+        rec->retiredSinceAdvance = 0;
+        tryAdvanceEpoch();
+    }
+}
+
+// ---------- hash table ----------
+
+struct ConcurrentTable {
+    _Atomic(struct Node*)* buckets;
+    int size;
+    pthread_mutex_t stripes[NUM_STRIPES];
+};
+
+struct ConcurrentTable* createTable(int size) {
+    struct ConcurrentTable* table = (struct ConcurrentTable*)malloc(sizeof(struct ConcurrentTable));
+    table->buckets = (_Atomic(struct Node*)*)calloc(size, sizeof(*table->buckets));
+    table->size = size;
+    for (int i = 0; i < NUM_STRIPES; i++) {
+        pthread_mutex_init(&table->stripes[i], NULL);
+    }
+    return table;
+}
+
+// Single-threaded teardown once all workers have joined
+void destroyTable(struct ConcurrentTable* table) {
+    for (int i = 0; i < table->size; i++) {
+        struct Node* temp = atomic_load(&table->buckets[i]);
+        while (temp != NULL) {
+            struct Node* next = atomic_load(&temp->next);
+            free(temp);
+            temp = next;
+        }
+    }
+    int count = atomic_load(&registeredThreads);
+    for (int t = 0; t < count; t++) {
+        for (int e = 0; e < 3; e++) freeLimbo(&records[t].limbo[e]);
+    }
+    for (int i = 0; i < NUM_STRIPES; i++) {
+        pthread_mutex_destroy(&table->stripes[i]);
+    }
+    free(table->buckets);
+    free(table);
+}
+
+int hashFunction(const struct ConcurrentTable* table, int key) {
+    return (int)((unsigned int)key % (unsigned int)table->size);
+}
+
+// Lock-free: only acquire loads, never blocks on writers
+int search(struct ConcurrentTable* table, int tid, int key) {
+    int result = -1;
+    enterEpoch(tid);
+
+    struct Node* temp = atomic_load_explicit(&table->buckets[hashFunction(table, key)], memory_order_acquire);
+    while (temp != NULL) {
+        if (temp->key == key) {
+            result = atomic_load_explicit(&temp->value, memory_order_relaxed);
+            break;
+        }
+        temp = atomic_load_explicit(&temp->next, memory_order_acquire);
+    }
+
+    exitEpoch(tid);
+    return result;
+}
+
+// Writers on the same stripe are serialized; a new node is fully built
+// before the release store publishes it at the chain head.
+void insert(struct ConcurrentTable* table, int tid, int key, int value) {
+    (void)tid;
+    int index = hashFunction(table, key);
+    pthread_mutex_t* lock = &table->stripes[index % NUM_STRIPES];
+    pthread_mutex_lock(lock);
+
+    struct Node* head = atomic_load_explicit(&table->buckets[index], memory_order_relaxed);
+    for (struct Node* temp = head; temp != NULL; temp = atomic_load_explicit(&temp->next, memory_order_relaxed)) {
+        if (temp->key == key) {
+            atomic_store_explicit(&temp->value, value, memory_order_relaxed);
+            pthread_mutex_unlock(lock);
+            return;
+        }
+    }
+
+    struct Node* newNode = (struct Node*)malloc(sizeof(struct Node));
+    newNode->key = key;
+    atomic_init(&newNode->value, value);
+    atomic_init(&newNode->next, head);
+    atomic_store_explicit(&table->buckets[index], newNode, memory_order_release);
+
+    pthread_mutex_unlock(lock);
+}
+
+int deleteKey(struct ConcurrentTable* table, int tid, int key) {
+    int index = hashFunction(table, key);
+    pthread_mutex_t* lock = &table->stripes[index % NUM_STRIPES];
+    int found = 0;
+
+    enterEpoch(tid);
+    pthread_mutex_lock(lock);
+
+    _Atomic(struct Node*)* link = &table->buckets[index];
+    struct Node* temp = atomic_load_explicit(link, memory_order_relaxed);
+    while (temp != NULL) {
+        struct Node* next = atomic_load_explicit(&temp->next, memory_order_relaxed);
+        if (temp->key == key) {
+            // Readers already on temp still see a valid next pointer
+            atomic_store_explicit(link, next, memory_order_release);
+            found = 1;
+            break;
+        }
+        link = &temp->next;
+        temp = next;
+    }
+
+    pthread_mutex_unlock(lock);
+    if (found) retireNode(tid, temp);
+    exitEpoch(tid);
+    return found;
+}
+
+// ---------- multi-threaded throughput benchmark ----------
+
+#define KEY_RANGE (1 << 20)
+#define TOTAL_OPS 2000000
+
+struct Worker {
+    pthread_t thread;
+    struct ConcurrentTable* table;
+    int tid;
+    int readPercent;
+    long ops;
+    long hits;
+};
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t nextRandom(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+static void* workerMain(void* arg) {
+    struct Worker* w = (struct Worker*)arg;
+    uint32_t seed = 0x9E3779B9u * (uint32_t)(w->tid + 1);
+
+    for (long i = 0; i < w->ops; i++) {
+        // The key and the operation come from separate draws, so the
+        // read/write mix is exact and inserts and deletes see the same keys
+        int key = (int)(nextRandom(&seed) % KEY_RANGE);
+        uint32_t op = nextRandom(&seed);
+
+        if ((int)(op % 100) < w->readPercent) {
+            w->hits += search(w->table, w->tid, key) != -1;
+        } else if (op >> 31) {
+            insert(w->table, w->tid, key, (int)i);
+        } else {
+            deleteKey(w->table, w->tid, key);
+        }
+    }
+    return NULL;
+}
+
+static void runBenchmark(int threads, int readPercent) {
+    struct ConcurrentTable* table = createTable(KEY_RANGE);
+    struct Worker workers[MAX_THREADS];
+
+    atomic_store(&registeredThreads, 0);
+    for (int i = 0; i < KEY_RANGE; i += 2) {
+        insert(table, 0, i, i);
+    }
+
+    double start = nowSeconds();
+    for (int t = 0; t < threads; t++) {
+        workers[t].table = table;
+        workers[t].tid = registerThread();
+        workers[t].readPercent = readPercent;
+        workers[t].ops = TOTAL_OPS / threads;
+        workers[t].hits = 0;
+        pthread_create(&workers[t].thread, NULL, workerMain, &workers[t]);
+    }
+    for (int t = 0; t < threads; t++) {
+        pthread_join(workers[t].thread, NULL);
+    }
+    double elapsed = nowSeconds() - start;
+
+    printf("%8d %6d/%-3d %12.2f\n", threads, readPercent, 100 - readPercent,
+           (double)(TOTAL_OPS / threads) * threads / elapsed / 1e6);
+    destroyTable(table);
+}
+
+int main() {
+    struct ConcurrentTable* table = createTable(10);
+    int tid = registerThread();
+
+    insert(table, tid, 1, 10);
+    insert(table, tid, 11, 20);
+    insert(table, tid, 21, 30);
+    insert(table, tid, 2, 40);
+    insert(table, tid, 12, 50);
+
+    printf("Search key 11: %d\n", search(table, tid, 11));
+    printf("Search key 25: %d\n", search(table, tid, 25));
+    deleteKey(table, tid, 11);
+    printf("Search key 11 after delete: %d\n", search(table, tid, 11));
+    destroyTable(table);
+
+    int threadCounts[] = {1, 2, 4, 8, 16, 32, 64};
+    int readMixes[] = {95, 50, 5};
+
+    printf("\n%8s %10s %12s\n", "threads", "read/write", "Mops/s");
+    for (int m = 0; m < 3; m++) {
+        for (int t = 0; t < 7; t++) {
+            runBenchmark(threadCounts[t], readMixes[m]);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,246 @@
+// Hash Functions and Collision Quality
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+// Every integer hash maps a 64-bit key straight to a bucket index in a
+// table of 1 << bits buckets.
+typedef size_t (*HashFunction)(uint64_t key, int bits);
+
+// Same as key % TABLE_SIZE for a power-of-two table
+size_t moduloHash(uint64_t key, int bits) {
+    return (size_t)(key & (((uint64_t)1 << bits) - 1));
+}
+
+// Multiply-shift (Fibonacci hashing): the top bits of key * 2^64/phi
+size_t fibonacciHash(uint64_t key, int bits) {
+    return (size_t)((key * 11400714819323198485ull) >> (64 - bits));
+}
+
+// wyhash-style mixer: fold the 128-bit product of the key with two secrets
+static uint64_t wymix(uint64_t a, uint64_t b) {
+    __uint128_t product = (__uint128_t)a * b;
+    return (uint64_t)product ^ (uint64_t)(product >> 64);
+}
+
+uint64_t mix64(uint64_t key) {
+    return wymix(key ^ 0xa0761d6478bd642full, key ^ 0xe7037ed1a0b428dbull);
+}
+
+size_t mixHash(uint64_t key, int bits) {
+    return (size_t)(mix64(key) >> (64 - bits));
+}
+
+// Fast byte-string hash in the same style: eight bytes per step
+uint64_t stringHash(const char* data, size_t length) {
+    uint64_t seed = 0x8ebc6af09c88c6e3ull ^ length;
+    uint64_t word;
+
+    while (length >= 8) {
+        memcpy(&word, data, 8);
+        seed = wymix(seed ^ word, 0x589965cc75374cc3ull);
+        data += 8;
+        length -= 8;
+    }
+
+    word = 0;
+    memcpy(&word, data, length);
+    return wymix(seed ^ word, 0x1d8e4e27c47d124full);
+}
+
+// ---------- chaining table with a selectable hash function ----------
+
+struct Node {
+    uint64_t key;
+    int value;
+    struct Node* next;
+};
+
+struct HashTable {
+    struct Node** buckets;
+    int bits;
+    HashFunction hash;
+};
+
+struct HashTable* createTable(int bits, HashFunction hash) {
+    struct HashTable* table = (struct HashTable*)malloc(sizeof(struct HashTable));
+    table->buckets = (struct Node**)calloc((size_t)1 << bits, sizeof(struct Node*));
+    table->bits = bits;
+    table->hash = hash;
+    return table;
+}
+
+void insert(struct HashTable* table, int64_t key, int value) {
+    size_t index = table->hash((uint64_t)key, table->bits);
+    struct Node* newNode = (struct Node*)malloc(sizeof(struct Node));
+    newNode->key = (uint64_t)key;
+    newNode->value = value;
+    newNode->next = table->buckets[index];
+    table->buckets[index] = newNode;
+}
+
+int search(const struct HashTable* table, int64_t key) {
+    struct Node* temp = table->buckets[table->hash((uint64_t)key, table->bits)];
+    while (temp != NULL) {
+        if (temp->key == (uint64_t)key) return temp->value;
+        temp = temp->next;
+    }
+    return -1;
+}
+
+void destroyTable(struct HashTable* table) {
+    for (size_t i = 0; i < ((size_t)1 << table->bits); i++) {
+        struct Node* temp = table->buckets[i];
+        while (temp != NULL) {
+            struct Node* next = temp->next;
+            free(temp);
+            temp = next;
+        }
+    }
+    free(table->buckets);
+    free(table);
+}
+
+// ---------- string-keyed table ----------
+
+struct StringNode {
+    char* key;
+    size_t length;
+    int value;
+    struct StringNode* next;
+};
+
+struct StringTable {
+    struct StringNode** buckets;
+    int bits;
+};
+
+struct StringTable* createStringTable(int bits) {
+    struct StringTable* table = (struct StringTable*)malloc(sizeof(struct StringTable));
+    table->buckets = (struct StringNode**)calloc((size_t)1 << bits, sizeof(struct StringNode*));
+    table->bits = bits;
+    return table;
+}
+
+void insertString(struct StringTable* table, const char* key, size_t length, int value) {
+    size_t index = (size_t)(stringHash(key, length) >> (64 - table->bits));
+    struct StringNode* newNode = (struct StringNode*)malloc(sizeof(struct StringNode));
+    newNode->key = (char*)malloc(length);
+    memcpy(newNode->key, key, length);
+    newNode->length = length;
+    newNode->value = value;
+    newNode->next = table->buckets[index];
+    table->buckets[index] = newNode;
+}
+
+int searchString(const struct StringTable* table, const char* key, size_t length) {
+    size_t index = (size_t)(stringHash(key, length) >> (64 - table->bits));
+    struct StringNode* temp = table->buckets[index];
+    while (temp != NULL) {
+        if (temp->length == length && memcmp(temp->key, key, length) == 0) return temp->value;
+        temp = temp->next;
+    }
+    return -1;
+}
+
+void destroyStringTable(struct StringTable* table) {
+    for (size_t i = 0; i < ((size_t)1 << table->bits); i++) {
+        struct StringNode* temp = table->buckets[i];
+        while (temp != NULL) {
+            struct StringNode* next = temp->next;
+            free(temp->key);
+            free(temp);
+            temp = next;
+        }
+    }
+    free(table->buckets);
+    free(table);
+}
+
+// ---------- collision-quality benchmark ----------
+
+#define BENCH_BITS 16
+#define BENCH_KEYS (1 << BENCH_BITS)
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void benchmark(const char* keySet, const int64_t keys[], const char* hashName, HashFunction hash) {
+    struct HashTable* table = createTable(BENCH_BITS, hash);
+    for (int i = 0; i < BENCH_KEYS; i++) insert(table, keys[i], i);
+
+    size_t buckets = (size_t)1 << BENCH_BITS;
+    size_t empty = 0, longest = 0, probes = 0;
+    for (size_t i = 0; i < buckets; i++) {
+        size_t length = 0;
+        for (struct Node* temp = table->buckets[i]; temp != NULL; temp = temp->next) length++;
+        if (length == 0) empty++;
+        if (length > longest) longest = length;
+        probes += length * (length + 1) / 2;   // Nodes visited finding every key in the chain
+    }
+
+    long checksum = 0;
+    double start = nowSeconds();
+    for (int i = 0; i < BENCH_KEYS; i++) checksum += search(table, keys[i]);
+    double ns = (nowSeconds() - start) * 1e9 / BENCH_KEYS;
+
+    // With a perfect hash ~36.8% of buckets stay empty at load factor 1
+    printf("%-10s %-10s %9.1f%% %8zu %8.2f %10.1f%s\n", keySet, hashName, 100.0 * empty / buckets,
+           longest, (double)probes / BENCH_KEYS, ns, checksum < 0 ? " !" : "");
+    destroyTable(table);
+}
+
+int main() {
+    struct HashTable* table = createTable(4, mixHash);
+    insert(table, 1, 10);
+    insert(table, -11, 20);
+    insert(table, 21, 30);
+    printf("Search key -11: %d\n", search(table, -11));
+    printf("Search key 25: %d\n", search(table, 25));
+    destroyTable(table);
+
+    struct StringTable* words = createStringTable(4);
+    insertString(words, "apple", 5, 1);
+    insertString(words, "banana", 6, 2);
+    insertString(words, "a much longer string key", 24, 3);
+    printf("Search \"banana\": %d\n", searchString(words, "banana", 6));
+    printf("Search \"cherry\": %d\n", searchString(words, "cherry", 6));
+    destroyStringTable(words);
+
+    int64_t* sequential = (int64_t*)malloc(BENCH_KEYS * sizeof(int64_t));
+    int64_t* strided = (int64_t*)malloc(BENCH_KEYS * sizeof(int64_t));
+    int64_t* random = (int64_t*)malloc(BENCH_KEYS * sizeof(int64_t));
+    uint64_t state = 88172645463325252ull;
+    for (int i = 0; i < BENCH_KEYS; i++) {
+        sequential[i] = i;
+        strided[i] = (int64_t)i * 1024;
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        random[i] = (int64_t)state;
+    }
+
+    const char* setNames[] = {"sequential", "strided", "random"};
+    int64_t* sets[] = {sequential, strided, random};
+    const char* hashNames[] = {"modulo", "fibonacci", "mix64"};
+    HashFunction hashes[] = {moduloHash, fibonacciHash, mixHash};
+
+    printf("\n%d keys into %d buckets\n", BENCH_KEYS, BENCH_KEYS);
+    printf("%-10s %-10s %10s %8s %8s %10s\n", "keys", "hash", "empty", "longest", "probes", "ns/lookup");
+    for (int s = 0; s < 3; s++) {
+        for (int h = 0; h < 3; h++) {
+            benchmark(setNames[s], sets[s], hashNames[h], hashes[h]);
+        }
+    }
+
+    free(sequential);
+    free(strided);
+    free(random);
+    return 0;
+}
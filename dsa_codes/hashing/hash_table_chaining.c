@@ -19,7 +19,8 @@ void initHashTable() {
 }
 
 int hashFunction(int key) {
-    return key % TABLE_SIZE;
+    // Unsigned modulo keeps negative keys inside the table
+    return (int)((unsigned int)key % TABLE_SIZE);
 }
 
 void insert(int key, int value) {
@@ -0,0 +1,279 @@
+// Hash Table with Chaining and a Slab Node Allocator
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define SLAB_NODES 1024   // Nodes carved out of each slab page
+
+struct Node {
+    int key;
+    int value;
+    struct Node* next;
+};
+
+// Chains get their nodes through this interface, so the table does not
+// care whether nodes come from malloc or from a slab.
+struct NodeAllocator {
+    struct Node* (*alloc)(struct NodeAllocator* self);
+    void (*release)(struct NodeAllocator* self, struct Node* node);
+    void (*releaseAll)(struct NodeAllocator* self);   // Frees every node at once; NULL if unsupported
+    long mallocCalls;
+    long freeCalls;
+    long nodesInUse;
+};
+
+// ---------- malloc allocator ----------
+
+static struct Node* mallocAlloc(struct NodeAllocator* self) {
+    self->mallocCalls++;
+    self->nodesInUse++;
+    return (struct Node*)malloc(sizeof(struct Node));
+}
+
+static void mallocRelease(struct NodeAllocator* self, struct Node* node) {
+    self->freeCalls++;
+    self->nodesInUse--;
+    free(node);
+}
+
+void initMallocAllocator(struct NodeAllocator* allocator) {
+    allocator->alloc = mallocAlloc;
+    allocator->release = mallocRelease;
+    allocator->releaseAll = NULL;
+    allocator->mallocCalls = 0;
+    allocator->freeCalls = 0;
+    allocator->nodesInUse = 0;
+}
+
+// ---------- slab allocator ----------
+
+struct Slab {
+    struct Slab* next;
+    struct Node nodes[SLAB_NODES];
+};
+
+struct SlabAllocator {
+    struct NodeAllocator base;   // Must stay first
+    struct Slab* slabs;
+    int usedInSlab;              // Nodes handed out from the newest slab
+    struct Node* freeList;       // Released nodes, linked through next
+};
+
+static struct Node* slabAlloc(struct NodeAllocator* self) {
+    struct SlabAllocator* slab = (struct SlabAllocator*)self;
+    self->nodesInUse++;
+
+    if (slab->freeList != NULL) {
+        struct Node* node = slab->freeList;
+        slab->freeList = node->next;
+        return node;
+    }
+
+    if (slab->slabs == NULL || slab->usedInSlab == SLAB_NODES) {
+        struct Slab* page = (struct Slab*)malloc(sizeof(struct Slab));
+        self->mallocCalls++;
+        page->next = slab->slabs;
+        slab->slabs = page;
+        slab->usedInSlab = 0;
+    }
+    return &slab->slabs->nodes[slab->usedInSlab++];
+}
+
+static void slabRelease(struct NodeAllocator* self, struct Node* node) {
+    struct SlabAllocator* slab = (struct SlabAllocator*)self;
+    self->nodesInUse--;
+    node->next = slab->freeList;
+    slab->freeList = node;
+}
+
+// Frees every slab page at once; cost depends on pages, not nodes
+static void slabReleaseAll(struct NodeAllocator* self) {
+    struct SlabAllocator* slab = (struct SlabAllocator*)self;
+    while (slab->slabs != NULL) {
+        struct Slab* next = slab->slabs->next;
+        free(slab->slabs);
+        self->freeCalls++;
+        slab->slabs = next;
+    }
+    slab->usedInSlab = 0;
+    slab->freeList = NULL;
+    self->nodesInUse = 0;
+}
+
+void initSlabAllocator(struct SlabAllocator* slab) {
+    slab->base.alloc = slabAlloc;
+    slab->base.release = slabRelease;
+    slab->base.releaseAll = slabReleaseAll;
+    slab->base.mallocCalls = 0;
+    slab->base.freeCalls = 0;
+    slab->base.nodesInUse = 0;
+    slab->slabs = NULL;
+    slab->usedInSlab = 0;
+    slab->freeList = NULL;
+}
+
+// ---------- hash table ----------
+
+struct HashTable {
+    struct Node** buckets;
+    int size;
+    struct NodeAllocator* allocator;
+    int ownsAllocator;   // Nothing else allocates from it, so teardown may drop it whole
+};
+
+// Pass ownsAllocator = 0 when other tables share the allocator
+struct HashTable* createTable(int size, struct NodeAllocator* allocator, int ownsAllocator) {
+    struct HashTable* table = (struct HashTable*)malloc(sizeof(struct HashTable));
+    table->buckets = (struct Node**)calloc(size, sizeof(struct Node*));
+    table->size = size;
+    table->allocator = allocator;
+    table->ownsAllocator = ownsAllocator;
+    return table;
+}
+
+int hashFunction(const struct HashTable* table, int key) {
+    return (int)((unsigned int)key % (unsigned int)table->size);
+}
+
+void insert(struct HashTable* table, int key, int value) {
+    int index = hashFunction(table, key);
+    struct Node* newNode = table->allocator->alloc(table->allocator);
+    newNode->key = key;
+    newNode->value = value;
+    newNode->next = table->buckets[index];
+    table->buckets[index] = newNode;
+}
+
+int search(const struct HashTable* table, int key) {
+    struct Node* temp = table->buckets[hashFunction(table, key)];
+
+    while (temp != NULL) {
+        if (temp->key == key) {
+            return temp->value;
+        }
+        temp = temp->next;
+    }
+
+    return -1;
+}
+
+// Removes the newest entry for key; returns 1 if one was found
+int deleteKey(struct HashTable* table, int key) {
+    struct Node** link = &table->buckets[hashFunction(table, key)];
+
+    while (*link != NULL) {
+        if ((*link)->key == key) {
+            struct Node* victim = *link;
+            *link = victim->next;
+            table->allocator->release(table->allocator, victim);
+            return 1;
+        }
+        link = &(*link)->next;
+    }
+
+    return 0;
+}
+
+// An owned allocator with releaseAll is emptied in one call, without
+// walking the chains; otherwise each node is released on its own, so a
+// shared allocator keeps the other tables' nodes
+void destroyTable(struct HashTable* table) {
+    struct NodeAllocator* allocator = table->allocator;
+
+    if (table->ownsAllocator && allocator->releaseAll != NULL) {
+        allocator->releaseAll(allocator);
+        free(table->buckets);
+        free(table);
+        return;
+    }
+    for (int i = 0; i < table->size; i++) {
+        struct Node* temp = table->buckets[i];
+        while (temp != NULL) {
+            struct Node* next = temp->next;
+            allocator->release(allocator, temp);
+            temp = next;
+        }
+    }
+
+    free(table->buckets);
+    free(table);
+}
+
+void display(const struct HashTable* table) {
+    for (int i = 0; i < table->size; i++) {
+        printf("Index %d: ", i);
+        struct Node* temp = table->buckets[i];
+        while (temp != NULL) {
+            printf("(%d, %d) -> ", temp->key, temp->value);
+            temp = temp->next;
+        }
+        printf("NULL\n");
+    }
+}
+
+void displayStats(const char* name, const struct NodeAllocator* allocator) {
+    printf("%-6s malloc calls: %ld, free calls: %ld, nodes in use: %ld\n",
+           name, allocator->mallocCalls, allocator->freeCalls, allocator->nodesInUse);
+}
+
+// ---------- benchmark ----------
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Insert n keys, delete half, reinsert them, then tear the table down
+static void runWorkload(const char* name, struct NodeAllocator* allocator, int n) {
+    struct HashTable* table = createTable(n, allocator, 1);
+    double t0 = nowSeconds();
+
+    for (int i = 0; i < n; i++) insert(table, i * 7, i);
+    for (int i = 0; i < n; i += 2) deleteKey(table, i * 7);
+    for (int i = 0; i < n; i += 2) insert(table, i * 7, i);
+
+    double t1 = nowSeconds();
+    destroyTable(table);
+    double t2 = nowSeconds();
+
+    printf("%-6s build %.1f ns/op, destroy %.3f ms\n", name, (t1 - t0) * 1e9 / (2 * n), (t2 - t1) * 1e3);
+    displayStats(name, allocator);
+}
+
+int main(int argc, char* argv[]) {
+    struct SlabAllocator slab;
+    initSlabAllocator(&slab);
+
+    struct HashTable* table = createTable(10, &slab.base, 1);
+
+    insert(table, 1, 10);
+    insert(table, 11, 20);
+    insert(table, 21, 30);
+    insert(table, 2, 40);
+    insert(table, 12, 50);
+
+    display(table);
+
+    printf("\nSearch key 11: %d\n", search(table, 11));
+    printf("Search key 25: %d\n", search(table, 25));
+
+    deleteKey(table, 11);
+    printf("Search key 11 after delete: %d\n", search(table, 11));
+    insert(table, 31, 60);   // Reuses the node freed above
+    displayStats("slab", &slab.base);
+
+    destroyTable(table);
+
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    struct NodeAllocator heap;
+    initMallocAllocator(&heap);
+    initSlabAllocator(&slab);
+
+    printf("\n%d keys\n", n);
+    runWorkload("malloc", &heap, n);
+    runWorkload("slab", &slab.base, n);
+
+    return 0;
+}
@@ -0,0 +1,232 @@
+// Hash Table with Chaining and Incremental Rehashing
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+
+#define INITIAL_SIZE 16
+#define MIGRATE_STEP 8    // Old buckets moved per insert/search while resizing
+#define HISTOGRAM_BUCKETS 40
+
+struct Node {
+    int key;
+    int value;
+    struct Node* next;
+};
+
+// While a resize is running both bucket arrays are live: old buckets
+// below migrateIndex are already empty, the rest still hold their chains.
+struct HashTable {
+    struct Node** buckets;
+    int bits;                 // buckets has 1 << bits entries
+    struct Node** oldBuckets; // NULL when no resize is in progress
+    int oldBits;
+    size_t migrateIndex;
+    size_t count;
+    int incremental;          // 0 = stop-the-world rehash, for comparison
+};
+
+static size_t hashIndex(int key, int bits) {
+    return (size_t)(((uint64_t)(uint32_t)key * 11400714819323198485ull) >> (64 - bits));
+}
+
+struct HashTable* createTable(int incremental) {
+    struct HashTable* table = (struct HashTable*)malloc(sizeof(struct HashTable));
+    table->bits = 4;
+    table->buckets = (struct Node**)calloc(INITIAL_SIZE, sizeof(struct Node*));
+    table->oldBuckets = NULL;
+    table->oldBits = 0;
+    table->migrateIndex = 0;
+    table->count = 0;
+    table->incremental = incremental;
+    return table;
+}
+
+// Moves up to steps old buckets into the new array
+static void migrate(struct HashTable* table, size_t steps) {
+    size_t oldSize = (size_t)1 << table->oldBits;
+
+    while (steps-- > 0 && table->migrateIndex < oldSize) {
+        struct Node* temp = table->oldBuckets[table->migrateIndex];
+        while (temp != NULL) {
+            struct Node* next = temp->next;
+            size_t index = hashIndex(temp->key, table->bits);
+            temp->next = table->buckets[index];
+            table->buckets[index] = temp;
+            temp = next;
+        }
+        table->oldBuckets[table->migrateIndex++] = NULL;
+    }
+
+    if (table->migrateIndex == oldSize) {
+        free(table->oldBuckets);
+        table->oldBuckets = NULL;
+    }
+}
+
+static void startResize(struct HashTable* table) {
+    table->oldBuckets = table->buckets;
+    table->oldBits = table->bits;
+    table->migrateIndex = 0;
+    table->bits++;
+    table->buckets = (struct Node**)calloc((size_t)1 << table->bits, sizeof(struct Node*));
+
+    if (!table->incremental) {
+        migrate(table, (size_t)1 << table->oldBits);
+    }
+}
+
+static struct Node* findNode(const struct HashTable* table, int key) {
+    struct Node* temp = table->buckets[hashIndex(key, table->bits)];
+    while (temp != NULL) {
+        if (temp->key == key) return temp;
+        temp = temp->next;
+    }
+
+    if (table->oldBuckets != NULL) {
+        size_t index = hashIndex(key, table->oldBits);
+        if (index >= table->migrateIndex) {
+            temp = table->oldBuckets[index];
+            while (temp != NULL) {
+                if (temp->key == key) return temp;
+                temp = temp->next;
+            }
+        }
+    }
+    return NULL;
+}
+
+void insert(struct HashTable* table, int key, int value) {
+    if (table->oldBuckets != NULL) migrate(table, MIGRATE_STEP);
+
+    struct Node* existing = findNode(table, key);
+    if (existing != NULL) {
+        existing->value = value;
+        return;
+    }
+
+    // Each resize finishes long before the next one is due, since the
+    // count must double again and every insert migrates MIGRATE_STEP buckets.
+    if (table->oldBuckets == NULL && table->count >= ((size_t)1 << table->bits)) {
+        startResize(table);
+    }
+
+    size_t index = hashIndex(key, table->bits);
+    struct Node* newNode = (struct Node*)malloc(sizeof(struct Node));
+    newNode->key = key;
+    newNode->value = value;
+    newNode->next = table->buckets[index];
+    table->buckets[index] = newNode;
+    table->count++;
+}
+
+int search(struct HashTable* table, int key) {
+    if (table->oldBuckets != NULL) migrate(table, MIGRATE_STEP);
+
+    struct Node* node = findNode(table, key);
+    return node != NULL ? node->value : -1;
+}
+
+void destroyTable(struct HashTable* table) {
+    struct Node** arrays[2] = { table->buckets, table->oldBuckets };
+    size_t sizes[2] = { (size_t)1 << table->bits, table->oldBuckets ? (size_t)1 << table->oldBits : 0 };
+
+    for (int a = 0; a < 2; a++) {
+        for (size_t i = 0; i < sizes[a]; i++) {
+            struct Node* temp = arrays[a][i];
+            while (temp != NULL) {
+                struct Node* next = temp->next;
+                free(temp);
+                temp = next;
+            }
+        }
+        free(arrays[a]);
+    }
+    free(table);
+}
+
+void display(const struct HashTable* table) {
+    for (size_t i = 0; i < ((size_t)1 << table->bits); i++) {
+        printf("Index %zu: ", i);
+        struct Node* temp = table->buckets[i];
+        while (temp != NULL) {
+            printf("(%d, %d) -> ", temp->key, temp->value);
+            temp = temp->next;
+        }
+        printf("NULL\n");
+    }
+}
+
+// ---------- latency benchmark ----------
+
+static uint64_t nowNanos() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+// Returns the upper bound (ns) of the log2 histogram bucket holding the given rank
+static uint64_t percentile(const long histogram[], long total, double fraction) {
+    long target = (long)(total * fraction);
+    long seen = 0;
+    for (int b = 0; b < HISTOGRAM_BUCKETS; b++) {
+        seen += histogram[b];
+        if (seen > target) return (uint64_t)1 << b;
+    }
+    return (uint64_t)1 << (HISTOGRAM_BUCKETS - 1);
+}
+
+// Inserts n keys one at a time, timing each insert
+static void latencyBenchmark(int incremental, long n) {
+    long histogram[HISTOGRAM_BUCKETS] = {0};
+    uint64_t maxLatency = 0;
+    struct HashTable* table = createTable(incremental);
+
+    uint64_t start = nowNanos();
+    for (long i = 0; i < n; i++) {
+        uint64_t t0 = nowNanos();
+        insert(table, (int)(i * 2654435761u), (int)i);
+        uint64_t elapsed = nowNanos() - t0;
+
+        int b = 0;
+        while (b < HISTOGRAM_BUCKETS - 1 && ((uint64_t)1 << b) < elapsed) b++;
+        histogram[b]++;
+        if (elapsed > maxLatency) maxLatency = elapsed;
+    }
+    double total = (nowNanos() - start) * 1e-9;
+
+    printf("\n%s rehash, %ld inserts in %.2f s\n", incremental ? "Incremental" : "Stop-the-world", n, total);
+    printf("p50 <= %llu ns, p99 <= %llu ns, p99.9 <= %llu ns, max = %llu ns\n",
+           (unsigned long long)percentile(histogram, n, 0.50),
+           (unsigned long long)percentile(histogram, n, 0.99),
+           (unsigned long long)percentile(histogram, n, 0.999),
+           (unsigned long long)maxLatency);
+    for (int b = 0; b < HISTOGRAM_BUCKETS; b++) {
+        if (histogram[b] > 0) printf("  <= %12llu ns: %ld\n", (unsigned long long)1 << b, histogram[b]);
+    }
+
+    destroyTable(table);
+}
+
+int main(int argc, char* argv[]) {
+    struct HashTable* table = createTable(1);
+
+    for (int i = 1; i <= 20; i++) {
+        insert(table, i * 10, i);   // Crosses the 16-entry resize threshold
+    }
+    printf("Resize in progress: %s (migrated %zu old buckets)\n",
+           table->oldBuckets != NULL ? "yes" : "no", table->migrateIndex);
+    printf("Search key 30: %d\n", search(table, 30));
+    printf("Search key 25: %d\n", search(table, 25));
+    display(table);
+    destroyTable(table);
+
+    // Pass 100000000 to grow all the way to 100M entries (needs ~3 GB)
+    long n = argc > 1 ? atol(argv[1]) : 10000000;
+    if (n < 1) n = 1;
+    latencyBenchmark(1, n);
+    latencyBenchmark(0, n);
+
+    return 0;
+}
@@ -0,0 +1,334 @@
+// LRU Cache (doubly linked list + hash table over one node pool)
+// Build: gcc -O2 -pthread lru_cache.c -lm
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <pthread.h>
+#include <time.h>
+
+#define NIL -1   // "NULL" for index links
+
+// Nodes live in one array and link to each other by index: prev/next form
+// the recency list (head = most recent), hashNext forms the bucket chain.
+struct LruNode {
+    int key;
+    int value;
+    int prev;
+    int next;
+    int hashNext;
+};
+
+struct LruCache {
+    struct LruNode* nodes;
+    int capacity;
+    int count;
+    int head;
+    int tail;
+    int* buckets;
+    uint32_t bucketMask;
+    long hits;
+    long misses;
+    long evictions;
+};
+
+static uint32_t hashKey(int key) {
+    uint32_t h = (uint32_t)key * 0x9E3779B1u;
+    return h ^ (h >> 16);
+}
+
+// A non-positive capacity is raised to 1, so a put always has a node to evict
+void initCache(struct LruCache* cache, int capacity) {
+    if (capacity < 1) capacity = 1;
+    uint32_t buckets = 1;
+    while (buckets < (uint32_t)capacity) buckets <<= 1;
+
+    cache->nodes = (struct LruNode*)malloc(capacity * sizeof(struct LruNode));
+    cache->capacity = capacity;
+    cache->count = 0;
+    cache->head = NIL;
+    cache->tail = NIL;
+    cache->buckets = (int*)malloc(buckets * sizeof(int));
+    cache->bucketMask = buckets - 1;
+    for (uint32_t i = 0; i < buckets; i++) cache->buckets[i] = NIL;
+    cache->hits = 0;
+    cache->misses = 0;
+    cache->evictions = 0;
+}
+
+void freeCache(struct LruCache* cache) {
+    free(cache->nodes);
+    free(cache->buckets);
+}
+
+static int findNode(const struct LruCache* cache, int key) {
+    int i = cache->buckets[hashKey(key) & cache->bucketMask];
+    while (i != NIL && cache->nodes[i].key != key) {
+        i = cache->nodes[i].hashNext;
+    }
+    return i;
+}
+
+static void unlinkNode(struct LruCache* cache, int i) {
+    struct LruNode* node = &cache->nodes[i];
+    if (node->prev != NIL) cache->nodes[node->prev].next = node->next;
+    else cache->head = node->next;
+    if (node->next != NIL) cache->nodes[node->next].prev = node->prev;
+    else cache->tail = node->prev;
+}
+
+static void pushFront(struct LruCache* cache, int i) {
+    struct LruNode* node = &cache->nodes[i];
+    node->prev = NIL;
+    node->next = cache->head;
+    if (cache->head != NIL) cache->nodes[cache->head].prev = i;
+    cache->head = i;
+    if (cache->tail == NIL) cache->tail = i;
+}
+
+static void removeFromBucket(struct LruCache* cache, int i) {
+    int* link = &cache->buckets[hashKey(cache->nodes[i].key) & cache->bucketMask];
+    while (*link != i) link = &cache->nodes[*link].hashNext;
+    *link = cache->nodes[i].hashNext;
+}
+
+// Returns the cached value and marks it most recent, or -1 on a miss
+int cacheGet(struct LruCache* cache, int key) {
+    int i = findNode(cache, key);
+    if (i == NIL) {
+        cache->misses++;
+        return -1;
+    }
+
+    cache->hits++;
+    if (i != cache->head) {
+        unlinkNode(cache, i);
+        pushFront(cache, i);
+    }
+    return cache->nodes[i].value;
+}
+
+// Inserts or updates key; when full, the least recent entry's slot is reused
+void cachePut(struct LruCache* cache, int key, int value) {
+    int i = findNode(cache, key);
+    if (i != NIL) {
+        cache->nodes[i].value = value;
+        if (i != cache->head) {
+            unlinkNode(cache, i);
+            pushFront(cache, i);
+        }
+        return;
+    }
+
+    if (cache->count < cache->capacity) {
+        i = cache->count++;
+    } else {
+        i = cache->tail;
+        unlinkNode(cache, i);
+        removeFromBucket(cache, i);
+        cache->evictions++;
+    }
+
+    uint32_t b = hashKey(key) & cache->bucketMask;
+    cache->nodes[i].key = key;
+    cache->nodes[i].value = value;
+    cache->nodes[i].hashNext = cache->buckets[b];
+    cache->buckets[b] = i;
+    pushFront(cache, i);
+}
+
+void display(const struct LruCache* cache) {
+    printf("MRU -> ");
+    for (int i = cache->head; i != NIL; i = cache->nodes[i].next) {
+        printf("(%d, %d) -> ", cache->nodes[i].key, cache->nodes[i].value);
+    }
+    printf("LRU\n");
+}
+
+// ---------- sharded variant for multi-threaded access ----------
+
+// Each shard is an independent LRU with its own lock; the high hash bits
+// pick the shard so shards and buckets use different bits.
+struct ShardedCache {
+    struct LruCache* shards;
+    pthread_mutex_t* locks;
+    int numShards;
+};
+
+void initShardedCache(struct ShardedCache* cache, int capacity, int numShards) {
+    if (numShards < 1) numShards = 1;
+    cache->shards = (struct LruCache*)malloc(numShards * sizeof(struct LruCache));
+    cache->locks = (pthread_mutex_t*)malloc(numShards * sizeof(pthread_mutex_t));
+    cache->numShards = numShards;
+    for (int s = 0; s < numShards; s++) {
+        initCache(&cache->shards[s], (capacity + numShards - 1) / numShards);
+        pthread_mutex_init(&cache->locks[s], NULL);
+    }
+}
+
+void freeShardedCache(struct ShardedCache* cache) {
+    for (int s = 0; s < cache->numShards; s++) {
+        freeCache(&cache->shards[s]);
+        pthread_mutex_destroy(&cache->locks[s]);
+    }
+    free(cache->shards);
+    free(cache->locks);
+}
+
+static int shardFor(const struct ShardedCache* cache, int key) {
+    return (int)(((uint64_t)(uint32_t)key * 0x9E3779B97F4A7C15ull >> 32) % (uint32_t)cache->numShards);
+}
+
+int shardedGet(struct ShardedCache* cache, int key) {
+    int s = shardFor(cache, key);
+    pthread_mutex_lock(&cache->locks[s]);
+    int value = cacheGet(&cache->shards[s], key);
+    pthread_mutex_unlock(&cache->locks[s]);
+    return value;
+}
+
+void shardedPut(struct ShardedCache* cache, int key, int value) {
+    int s = shardFor(cache, key);
+    pthread_mutex_lock(&cache->locks[s]);
+    cachePut(&cache->shards[s], key, value);
+    pthread_mutex_unlock(&cache->locks[s]);
+}
+
+// ---------- trace-replay benchmark ----------
+
+#define KEY_SPACE 1000000
+#define CACHE_CAPACITY 100000
+#define TRACE_LENGTH 5000000
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Zipf(0.99) trace over KEY_SPACE keys, sampled by binary search on the CDF
+static int* makeZipfTrace(int length) {
+    double* cdf = (double*)malloc(KEY_SPACE * sizeof(double));
+    double sum = 0;
+    for (int k = 0; k < KEY_SPACE; k++) {
+        sum += 1.0 / pow(k + 1, 0.99);
+        cdf[k] = sum;
+    }
+
+    int* trace = (int*)malloc(length * sizeof(int));
+    uint64_t state = 88172645463325252ull;
+    for (int i = 0; i < length; i++) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        double u = (state >> 11) * (1.0 / 9007199254740992.0) * sum;
+
+        int lo = 0, hi = KEY_SPACE - 1;
+        while (lo < hi) {
+            int mid = lo + (hi - lo) / 2;
+            if (cdf[mid] < u) lo = mid + 1;
+            else hi = mid;
+        }
+        trace[i] = (int)(((uint32_t)lo * 2654435761u) & 0x7fffffff);   // Scatter popular keys
+    }
+    free(cdf);
+    return trace;
+}
+
+// Reads whitespace-separated integer keys
+static int* readTrace(const char* path, int* length) {
+    FILE* file = fopen(path, "r");
+    if (file == NULL) return NULL;
+
+    int capacity = 1 << 20, count = 0, key;
+    int* trace = (int*)malloc(capacity * sizeof(int));
+    while (fscanf(file, "%d", &key) == 1) {
+        if (count == capacity) {
+            capacity *= 2;
+            trace = (int*)realloc(trace, capacity * sizeof(int));
+        }
+        trace[count++] = key;
+    }
+    fclose(file);
+    *length = count;
+    return trace;
+}
+
+struct ReplayWorker {
+    pthread_t thread;
+    struct ShardedCache* cache;
+    const int* trace;
+    int begin;
+    int end;
+};
+
+static void* replayWorker(void* arg) {
+    struct ReplayWorker* w = (struct ReplayWorker*)arg;
+    for (int i = w->begin; i < w->end; i++) {
+        if (shardedGet(w->cache, w->trace[i]) == -1) shardedPut(w->cache, w->trace[i], i);
+    }
+    return NULL;
+}
+
+int main(int argc, char* argv[]) {
+    struct LruCache cache;
+    initCache(&cache, 3);
+
+    cachePut(&cache, 1, 10);
+    cachePut(&cache, 2, 20);
+    cachePut(&cache, 3, 30);
+    printf("Get key 1: %d\n", cacheGet(&cache, 1));
+    cachePut(&cache, 4, 40);   // Evicts key 2, the least recently used
+    printf("Get key 2: %d\n", cacheGet(&cache, 2));
+    display(&cache);
+    freeCache(&cache);
+
+    int length = TRACE_LENGTH;
+    int* trace = argc > 1 ? readTrace(argv[1], &length) : makeZipfTrace(length);
+    if (trace == NULL || length == 0) {
+        printf("Could not read trace %s\n", argv[1]);
+        return 1;
+    }
+
+    // Single-threaded replay: get, and put on a miss
+    initCache(&cache, CACHE_CAPACITY);
+    double start = nowSeconds();
+    for (int i = 0; i < length; i++) {
+        if (cacheGet(&cache, trace[i]) == -1) cachePut(&cache, trace[i], i);
+    }
+    double ns = (nowSeconds() - start) * 1e9 / length;
+
+    printf("\n%s trace, %d requests, capacity %d\n", argc > 1 ? argv[1] : "Zipf(0.99)", length, CACHE_CAPACITY);
+    printf("hit rate %.2f%%, hits %ld, misses %ld, evictions %ld, %.1f ns/request\n",
+           100.0 * cache.hits / length, cache.hits, cache.misses, cache.evictions, ns);
+    freeCache(&cache);
+
+    printf("\n%8s %8s %10s %12s\n", "threads", "shards", "hit rate", "ns/request");
+    int threadCounts[] = {1, 2, 4, 8};
+    for (int t = 0; t < 4; t++) {
+        int threads = threadCounts[t];
+        struct ShardedCache sharded;
+        struct ReplayWorker workers[8];
+        initShardedCache(&sharded, CACHE_CAPACITY, 16);
+
+        start = nowSeconds();
+        for (int w = 0; w < threads; w++) {
+            workers[w].cache = &sharded;
+            workers[w].trace = trace;
+            workers[w].begin = (int)((long)length * w / threads);
+            workers[w].end = (int)((long)length * (w + 1) / threads);
+            pthread_create(&workers[w].thread, NULL, replayWorker, &workers[w]);
+        }
+        for (int w = 0; w < threads; w++) pthread_join(workers[w].thread, NULL);
+        ns = (nowSeconds() - start) * 1e9 / length;
+
+        long hits = 0;
+        for (int s = 0; s < sharded.numShards; s++) hits += sharded.shards[s].hits;
+        printf("%8d %8d %9.2f%% %12.1f\n", threads, sharded.numShards, 100.0 * hits / length, ns);
+        freeShardedCache(&sharded);
+    }
+
+    free(trace);
+    return 0;
+}
@@ -0,0 +1,295 @@
+// Open Addressing Hash Table (Robin Hood Hashing)
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define MIN_CAPACITY 16
+#define MAX_PROBE 64      // Longest probe distance allowed before the table grows
+#define GROUP_WIDTH 16    // Control bytes compared per SIMD step
+
+struct Slot {
+    int key;
+    int value;
+};
+
+// Each slot has one control byte: 0 means empty, otherwise the probe
+// distance from the key's home slot plus one. The arrays are padded with
+// MAX_PROBE overflow slots instead of wrapping around, so probes never wrap.
+struct OpenTable {
+    uint8_t* ctrl;
+    struct Slot* slots;
+    size_t capacity;   // Always a power of two
+    int shift;         // 64 - log2(capacity), for Fibonacci hashing
+    size_t size;
+};
+
+static size_t homeSlot(const struct OpenTable* table, int key) {
+    return (size_t)(((uint64_t)(uint32_t)key * 11400714819323198485ull) >> table->shift);
+}
+
+static void allocTable(struct OpenTable* table, size_t capacity) {
+    int bits = 0;
+    while (((size_t)1 << bits) < capacity) bits++;
+
+    table->capacity = (size_t)1 << bits;
+    table->shift = 64 - bits;
+    table->size = 0;
+    table->ctrl = (uint8_t*)calloc(table->capacity + MAX_PROBE + GROUP_WIDTH, 1);
+    table->slots = (struct Slot*)malloc((table->capacity + MAX_PROBE) * sizeof(struct Slot));
+}
+
+struct OpenTable* createTable(size_t capacity) {
+    struct OpenTable* table = (struct OpenTable*)malloc(sizeof(struct OpenTable));
+    allocTable(table, capacity < MIN_CAPACITY ? MIN_CAPACITY : capacity);
+    return table;
+}
+
+void freeTable(struct OpenTable* table) {
+    free(table->ctrl);
+    free(table->slots);
+    free(table);
+}
+
+// Returns the slot holding key, or -1. A Robin Hood probe can stop at the
+// first slot whose distance is shorter than ours: the key would have
+// displaced that entry had it been inserted.
+static long findSlot(const struct OpenTable* table, int key) {
+    size_t pos = homeSlot(table, key);
+
+#ifdef __SSE2__
+    // Slots pos+i whose control byte equals i+1 share our home slot
+    __m128i expect = _mm_setr_epi8(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
+    const __m128i step = _mm_set1_epi8(GROUP_WIDTH);
+
+    for (int d = 0; d < MAX_PROBE; d += GROUP_WIDTH) {
+        __m128i group = _mm_loadu_si128((const __m128i*)(table->ctrl + pos + d));
+        unsigned stop = (unsigned)_mm_movemask_epi8(_mm_cmplt_epi8(group, expect));
+        unsigned match = (unsigned)_mm_movemask_epi8(_mm_cmpeq_epi8(group, expect));
+
+        if (stop) match &= (stop & -stop) - 1;
+        while (match) {
+            size_t i = pos + d + __builtin_ctz(match);
+            if (table->slots[i].key == key) return (long)i;
+            match &= match - 1;
+        }
+        if (stop) return -1;
+        expect = _mm_add_epi8(expect, step);
+    }
+#else
+    for (int dist = 1; dist <= MAX_PROBE; dist++, pos++) {
+        if (table->ctrl[pos] < dist) return -1;
+        if (table->ctrl[pos] == dist && table->slots[pos].key == key) return (long)pos;
+    }
+#endif
+    return -1;
+}
+
+// Robin Hood placement: steal the slot of any entry closer to its home.
+// Returns 0 if the carried entry would exceed MAX_PROBE; *key and *value
+// then hold whichever entry is still looking for a slot.
+static int placeEntry(struct OpenTable* table, int* key, int* value) {
+    size_t pos = homeSlot(table, *key);
+
+    for (int dist = 1; dist <= MAX_PROBE; dist++, pos++) {
+        int current = table->ctrl[pos];
+
+        if (current == 0) {
+            table->ctrl[pos] = (uint8_t)dist;
+            table->slots[pos].key = *key;
+            table->slots[pos].value = *value;
+            table->size++;
+            return 1;
+        }
+
+        if (current < dist) {
+            struct Slot evicted = table->slots[pos];
+            table->ctrl[pos] = (uint8_t)dist;
+            table->slots[pos].key = *key;
+            table->slots[pos].value = *value;
+            *key = evicted.key;
+            *value = evicted.value;
+            dist = current;
+        }
+    }
+    return 0;
+}
+
+static void grow(struct OpenTable* table) {
+    uint8_t* oldCtrl = table->ctrl;
+    struct Slot* oldSlots = table->slots;
+    size_t oldTotal = table->capacity + MAX_PROBE;
+
+    allocTable(table, table->capacity * 2);
+
+    for (size_t i = 0; i < oldTotal; i++) {
+        if (oldCtrl[i] != 0) {
+            int key = oldSlots[i].key;
+            int value = oldSlots[i].value;
+            while (!placeEntry(table, &key, &value)) {
+                grow(table);
+            }
+        }
+    }
+
+    free(oldCtrl);
+    free(oldSlots);
+}
+
+// Inserts key or overwrites its value, growing at a 7/8 load factor
+void insert(struct OpenTable* table, int key, int value) {
+    long pos = findSlot(table, key);
+    if (pos >= 0) {
+        table->slots[pos].value = value;
+        return;
+    }
+
+    if ((table->size + 1) * 8 > table->capacity * 7) {
+        grow(table);
+    }
+
+    while (!placeEntry(table, &key, &value)) {
+        grow(table);
+    }
+}
+
+int search(const struct OpenTable* table, int key) {
+    long pos = findSlot(table, key);
+    return pos >= 0 ? table->slots[pos].value : -1;
+}
+
+// Backward-shift deletion: pull the following entries one slot closer to
+// their homes, so no tombstones are ever left behind.
+int deleteKey(struct OpenTable* table, int key) {
+    long found = findSlot(table, key);
+    if (found < 0) return 0;
+
+    size_t pos = (size_t)found;
+    while (table->ctrl[pos + 1] > 1) {
+        table->ctrl[pos] = table->ctrl[pos + 1] - 1;
+        table->slots[pos] = table->slots[pos + 1];
+        pos++;
+    }
+    table->ctrl[pos] = 0;
+    table->size--;
+    return 1;
+}
+
+void display(const struct OpenTable* table) {
+    for (size_t i = 0; i < table->capacity + MAX_PROBE; i++) {
+        if (table->ctrl[i] != 0) {
+            printf("Slot %zu: (%d, %d) probe %d\n", i, table->slots[i].key,
+                   table->slots[i].value, table->ctrl[i] - 1);
+        }
+    }
+}
+
+// ---------- Benchmark against a chaining table of the same bucket count ----------
+
+struct ChainNode {
+    int key;
+    int value;
+    struct ChainNode* next;
+};
+
+struct ChainTable {
+    struct ChainNode** buckets;
+    size_t size;
+};
+
+static void chainInsert(struct ChainTable* table, int key, int value) {
+    size_t index = (uint32_t)key % table->size;
+    struct ChainNode* newNode = (struct ChainNode*)malloc(sizeof(struct ChainNode));
+    newNode->key = key;
+    newNode->value = value;
+    newNode->next = table->buckets[index];
+    table->buckets[index] = newNode;
+}
+
+static int chainSearch(const struct ChainTable* table, int key) {
+    struct ChainNode* temp = table->buckets[(uint32_t)key % table->size];
+    while (temp != NULL) {
+        if (temp->key == key) return temp->value;
+        temp = temp->next;
+    }
+    return -1;
+}
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t nextRandom(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+static void benchmark(int n) {
+    int* keys = (int*)malloc(n * sizeof(int));
+    uint32_t seed = 2463534242u;
+    for (int i = 0; i < n; i++) keys[i] = (int)nextRandom(&seed);
+
+    struct ChainTable chain = { (struct ChainNode**)calloc(n, sizeof(struct ChainNode*)), (size_t)n };
+    struct OpenTable* open = createTable(MIN_CAPACITY);
+    long checksum = 0;
+
+    double t0 = nowSeconds();
+    for (int i = 0; i < n; i++) chainInsert(&chain, keys[i], i);
+    double t1 = nowSeconds();
+    for (int i = 0; i < n; i++) checksum += chainSearch(&chain, keys[i]);
+    double t2 = nowSeconds();
+    for (int i = 0; i < n; i++) insert(open, keys[i], i);
+    double t3 = nowSeconds();
+    for (int i = 0; i < n; i++) checksum -= search(open, keys[i]);
+    double t4 = nowSeconds();
+
+    printf("\n%d random keys (ns/op)\n", n);
+    printf("%-10s %10s %10s\n", "table", "insert", "search");
+    printf("%-10s %10.1f %10.1f\n", "chaining", (t1 - t0) * 1e9 / n, (t2 - t1) * 1e9 / n);
+    printf("%-10s %10.1f %10.1f\n", "robinhood", (t3 - t2) * 1e9 / n, (t4 - t3) * 1e9 / n);
+    printf("checksum %s\n", checksum == 0 ? "ok" : "MISMATCH");
+
+    for (int i = 0; i < n; i++) {
+        struct ChainNode* temp = chain.buckets[i];
+        while (temp != NULL) {
+            struct ChainNode* next = temp->next;
+            free(temp);
+            temp = next;
+        }
+    }
+    free(chain.buckets);
+    freeTable(open);
+    free(keys);
+}
+
+int main(int argc, char* argv[]) {
+    struct OpenTable* table = createTable(MIN_CAPACITY);
+
+    insert(table, 1, 10);
+    insert(table, 11, 20);
+    insert(table, 21, 30);
+    insert(table, 2, 40);
+    insert(table, 12, 50);
+
+    display(table);
+
+    printf("\nSearch key 11: %d\n", search(table, 11));
+    printf("Search key 25: %d\n", search(table, 25));
+
+    deleteKey(table, 11);
+    printf("Search key 11 after delete: %d\n", search(table, 11));
+    printf("Search key 21 after delete: %d\n", search(table, 21));
+
+    freeTable(table);
+
+    benchmark(argc > 1 ? atoi(argv[1]) : 1000000);
+    return 0;
+}
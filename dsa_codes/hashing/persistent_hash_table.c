@@ -0,0 +1,323 @@
+// Persistent Hash Table (flat file, queried in place through mmap)
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define FILE_MAGIC 0x3148534841534400ull   // "\0DSAHSH1"
+#define FILE_VERSION 1
+
+struct Node {
+    int key;
+    int value;
+    struct Node* next;
+};
+
+struct HashTable {
+    struct Node** buckets;
+    uint32_t size;
+    uint32_t count;
+};
+
+// On-disk layout, all offsets relative to the start of the file:
+//   FileHeader
+//   uint32_t bucketStart[bucketCount + 1]   entries of bucket b are
+//                                           [bucketStart[b], bucketStart[b + 1])
+//   struct FileEntry entries[entryCount]    grouped by bucket
+// No pointers are stored, so the file can be mapped at any address.
+struct FileHeader {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t bucketCount;
+    uint32_t entryCount;
+    uint32_t reserved;
+    uint64_t bucketsOffset;
+    uint64_t entriesOffset;
+    uint64_t fileSize;
+    uint64_t checksum;   // Over everything after the header
+};
+
+struct FileEntry {
+    int key;
+    int value;
+};
+
+struct MappedTable {
+    const struct FileHeader* header;
+    const uint32_t* bucketStart;
+    const struct FileEntry* entries;
+    size_t length;
+};
+
+// ---------- in-memory table (same API as hash_table_chaining.c) ----------
+
+struct HashTable* createTable(uint32_t size) {
+    struct HashTable* table = (struct HashTable*)malloc(sizeof(struct HashTable));
+    table->buckets = (struct Node**)calloc(size, sizeof(struct Node*));
+    table->size = size;
+    table->count = 0;
+    return table;
+}
+
+uint32_t hashFunction(uint32_t size, int key) {
+    return (uint32_t)key % size;
+}
+
+void insert(struct HashTable* table, int key, int value) {
+    uint32_t index = hashFunction(table->size, key);
+    struct Node* newNode = (struct Node*)malloc(sizeof(struct Node));
+    newNode->key = key;
+    newNode->value = value;
+    newNode->next = table->buckets[index];
+    table->buckets[index] = newNode;
+    table->count++;
+}
+
+int search(const struct HashTable* table, int key) {
+    struct Node* temp = table->buckets[hashFunction(table->size, key)];
+    while (temp != NULL) {
+        if (temp->key == key) return temp->value;
+        temp = temp->next;
+    }
+    return -1;
+}
+
+void destroyTable(struct HashTable* table) {
+    for (uint32_t i = 0; i < table->size; i++) {
+        struct Node* temp = table->buckets[i];
+        while (temp != NULL) {
+            struct Node* next = temp->next;
+            free(temp);
+            temp = next;
+        }
+    }
+    free(table->buckets);
+    free(table);
+}
+
+// ---------- file format ----------
+
+static uint64_t checksum64(const void* data, size_t length) {
+    const unsigned char* bytes = (const unsigned char*)data;
+    uint64_t hash = 0xcbf29ce484222325ull;
+    uint64_t word;
+
+    for (; length >= 8; length -= 8, bytes += 8) {
+        memcpy(&word, bytes, 8);
+        hash = (hash ^ word) * 0x100000001b3ull;
+        hash ^= hash >> 29;
+    }
+    for (; length > 0; length--, bytes++) {
+        hash = (hash ^ *bytes) * 0x100000001b3ull;
+    }
+    return hash;
+}
+
+// Returns 0 on success, -1 on I/O failure
+int saveTable(const struct HashTable* table, const char* path) {
+    size_t bucketsBytes = ((size_t)table->size + 1) * sizeof(uint32_t);
+    size_t entriesBytes = (size_t)table->count * sizeof(struct FileEntry);
+    size_t headerBytes = sizeof(struct FileHeader);
+    size_t entriesOffset = (headerBytes + bucketsBytes + 7) & ~(size_t)7;
+    size_t fileSize = entriesOffset + entriesBytes;
+
+    unsigned char* image = (unsigned char*)calloc(1, fileSize);
+    if (image == NULL) return -1;
+
+    struct FileHeader* header = (struct FileHeader*)image;
+    uint32_t* bucketStart = (uint32_t*)(image + headerBytes);
+    struct FileEntry* entries = (struct FileEntry*)(image + entriesOffset);
+
+    // Chains are stored newest first, matching search() on the live table
+    uint32_t next = 0;
+    for (uint32_t b = 0; b < table->size; b++) {
+        bucketStart[b] = next;
+        for (struct Node* temp = table->buckets[b]; temp != NULL; temp = temp->next) {
+            entries[next].key = temp->key;
+            entries[next].value = temp->value;
+            next++;
+        }
+    }
+    bucketStart[table->size] = next;
+
+    header->magic = FILE_MAGIC;
+    header->version = FILE_VERSION;
+    header->bucketCount = table->size;
+    header->entryCount = table->count;
+    header->bucketsOffset = headerBytes;
+    header->entriesOffset = entriesOffset;
+    header->fileSize = fileSize;
+    header->checksum = checksum64(image + headerBytes, fileSize - headerBytes);
+
+    FILE* file = fopen(path, "wb");
+    if (file == NULL) {
+        free(image);
+        return -1;
+    }
+    size_t written = fwrite(image, 1, fileSize, file);
+    int closed = fclose(file);
+    free(image);
+    return (written == fileSize && closed == 0) ? 0 : -1;
+}
+
+// Maps the file read-only. Header fields are always validated; the full
+// checksum pass is optional because it reads every page of the file.
+// Returns 0 on success, -1 if the file is missing, truncated or corrupt.
+int openMappedTable(struct MappedTable* map, const char* path, int verifyChecksum) {
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || (size_t)info.st_size < sizeof(struct FileHeader)) {
+        close(fd);
+        return -1;
+    }
+
+    size_t length = (size_t)info.st_size;
+    void* base = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (base == MAP_FAILED) return -1;
+
+    // Both sections must lie after the header, in order, inside the file
+    // and aligned for their element type. Sizes are compared against the
+    // room left after each offset so no sum can overflow.
+    const struct FileHeader* header = (const struct FileHeader*)base;
+    uint64_t bucketsBytes = ((uint64_t)header->bucketCount + 1) * sizeof(uint32_t);
+    uint64_t entriesBytes = (uint64_t)header->entryCount * sizeof(struct FileEntry);
+    int valid = header->magic == FILE_MAGIC &&
+                header->version == FILE_VERSION &&
+                header->fileSize == length &&
+                header->bucketCount > 0 &&
+                header->bucketsOffset >= sizeof(struct FileHeader) &&
+                header->bucketsOffset % sizeof(uint32_t) == 0 &&
+                header->bucketsOffset <= length &&
+                bucketsBytes <= length - header->bucketsOffset &&
+                header->entriesOffset >= header->bucketsOffset + bucketsBytes &&
+                header->entriesOffset % sizeof(int) == 0 &&
+                header->entriesOffset <= length &&
+                entriesBytes <= length - header->entriesOffset;
+
+    if (valid && verifyChecksum) {
+        valid = checksum64((const unsigned char*)base + sizeof(struct FileHeader),
+                           length - sizeof(struct FileHeader)) == header->checksum;
+    }
+    if (!valid) {
+        munmap(base, length);
+        return -1;
+    }
+
+    map->header = header;
+    map->bucketStart = (const uint32_t*)((const unsigned char*)base + header->bucketsOffset);
+    map->entries = (const struct FileEntry*)((const unsigned char*)base + header->entriesOffset);
+    map->length = length;
+    return 0;
+}
+
+int mappedSearch(const struct MappedTable* map, int key) {
+    uint32_t b = hashFunction(map->header->bucketCount, key);
+    uint32_t end = map->bucketStart[b + 1];
+    if (end > map->header->entryCount) end = map->header->entryCount;   // Unverified files stay in bounds
+
+    for (uint32_t i = map->bucketStart[b]; i < end; i++) {
+        if (map->entries[i].key == key) return map->entries[i].value;
+    }
+    return -1;
+}
+
+void closeMappedTable(struct MappedTable* map) {
+    munmap((void*)map->header, map->length);
+}
+
+// ---------- benchmark: time to first lookup ----------
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char* argv[]) {
+    const char* path = "hash_table.bin";
+    struct HashTable* table = createTable(10);
+
+    insert(table, 1, 10);
+    insert(table, 11, 20);
+    insert(table, 21, 30);
+    insert(table, 2, 40);
+    insert(table, 12, 50);
+
+    struct MappedTable map;
+    if (saveTable(table, path) != 0 || openMappedTable(&map, path, 1) != 0) {
+        printf("Could not write or map %s\n", path);
+        destroyTable(table);
+        return 1;
+    }
+    printf("Mapped search key 11: %d\n", mappedSearch(&map, 11));
+    printf("Mapped search key 25: %d\n", mappedSearch(&map, 25));
+    closeMappedTable(&map);
+    destroyTable(table);
+
+    uint32_t n = argc > 1 ? (uint32_t)atol(argv[1]) : 5000000;
+    if (n == 0) n = 1;
+    int* keys = (int*)malloc(n * sizeof(int));
+    uint32_t state = 2463534242u;
+    for (uint32_t i = 0; i < n; i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        keys[i] = (int)state;
+    }
+
+    table = createTable(n);
+    for (uint32_t i = 0; i < n; i++) insert(table, keys[i], (int)i);
+    int saved = saveTable(table, path);
+    destroyTable(table);
+    if (saved != 0) {
+        printf("Could not write %s\n", path);
+        free(keys);
+        return 1;
+    }
+
+    int probe = keys[n / 2];
+    double t0 = nowSeconds();
+    table = createTable(n);
+    for (uint32_t i = 0; i < n; i++) insert(table, keys[i], (int)i);
+    int rebuilt = search(table, probe);
+    double t1 = nowSeconds();
+    if (openMappedTable(&map, path, 0) != 0) {
+        printf("Could not map %s\n", path);
+        destroyTable(table);
+        free(keys);
+        return 1;
+    }
+    int mapped = mappedSearch(&map, probe);
+    double t2 = nowSeconds();
+    closeMappedTable(&map);
+    double t3 = nowSeconds();
+    if (openMappedTable(&map, path, 1) != 0) {
+        printf("Checksum of %s does not match\n", path);
+        destroyTable(table);
+        free(keys);
+        return 1;
+    }
+    int verified = mappedSearch(&map, probe);
+    double t4 = nowSeconds();
+    closeMappedTable(&map);
+
+    printf("\n%u keys, time to first lookup\n", n);
+    printf("rebuild with insert    %10.3f ms\n", (t1 - t0) * 1e3);
+    printf("mmap                   %10.3f ms\n", (t2 - t1) * 1e3);
+    printf("mmap + checksum        %10.3f ms\n", (t4 - t3) * 1e3);
+    printf("results %s\n", rebuilt == mapped && mapped == verified ? "match" : "MISMATCH");
+
+    destroyTable(table);
+    free(keys);
+    remove(path);
+    return 0;
+}
@@ -0,0 +1,437 @@
+// Adaptive Search (prepared search that picks its algorithm from the data)
+// Build: gcc -O2 adaptive_search.c -lm
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <limits.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+
+#define LINEAR_MAX 32               // Below this a scan beats any search
+#define LINEAR_CALIBRATION_MAX 4096 // Above this a scan cannot win
+#define PROFILE_SAMPLES 256
+#define CALIBRATION_QUERIES 4096
+#define CALIBRATION_BUDGET 0.02     // Seconds per strategy
+#define DEFAULT_L2 (1024 * 1024)
+
+// ---------- the candidates ----------
+
+// The original linear search from linear_search.c
+int linearSearch(int arr[], int n, int key) {
+    for (int i = 0; i < n; i++) {
+        if (arr[i] == key) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// The original binary search from binary_search.c
+int binarySearch(int arr[], int left, int right, int key) {
+    while (left <= right) {
+        int mid = left + (right - left) / 2;
+
+        if (arr[mid] == key) {
+            return mid;
+        }
+
+        if (arr[mid] < key) {
+            left = mid + 1;
+        } else {
+            right = mid - 1;
+        }
+    }
+
+    return -1;
+}
+
+// The original exponential search from exponential_search.c
+int exponentialSearch(int arr[], int n, int x) {
+    if (arr[0] == x)
+        return 0;
+
+    int i = 1;
+    while (i < n && arr[i] <= x)
+        i = i * 2;
+
+    return binarySearch(arr, i / 2, (i < n) ? i : n - 1, x);
+}
+
+// interpolationSearch from interpolation_search.c, plus a guard for
+// arr[hi] == arr[lo], which the original divides by
+int interpolationSearch(int arr[], int n, int x) {
+    int lo = 0, hi = (n - 1);
+
+    while (lo <= hi && x >= arr[lo] && x <= arr[hi]) {
+        if (lo == hi || arr[hi] == arr[lo]) {
+            if (arr[lo] == x) return lo;
+            return -1;
+        }
+
+        int pos = lo + (((double)(hi - lo) / ((double)arr[hi] - arr[lo])) * ((double)x - arr[lo]));
+
+        if (arr[pos] == x)
+            return pos;
+
+        if (arr[pos] < x)
+            lo = pos + 1;
+        else
+            hi = pos - 1;
+    }
+    return -1;
+}
+
+// Branchless lower bound from eytzinger_search.c, as a search
+static int branchlessSearch(const int arr[], int n, int key) {
+    const int* base = arr;
+    int len = n;
+    while (len > 1) {
+        int half = len / 2;
+        len -= half;
+        base += (base[half - 1] < key) * half;
+    }
+    int i = (int)(base - arr) + (*base < key);
+    return i < n && arr[i] == key ? i : -1;
+}
+
+// Eytzinger layout from eytzinger_search.c: keys[1..n] in BFS order
+static int fillEytzinger(int keys[], int rank[], int n, const int sorted[], int i, size_t k) {
+    if (k <= (size_t)n) {
+        i = fillEytzinger(keys, rank, n, sorted, i, 2 * k);
+        keys[k] = sorted[i];
+        rank[k] = i;
+        i++;
+        i = fillEytzinger(keys, rank, n, sorted, i, 2 * k + 1);
+    }
+    return i;
+}
+
+static int eytzingerSearch(const int keys[], const int rank[], int n, int key) {
+    unsigned k = 1;   // Reaches 2n + 1, past INT_MAX for n = 2^30
+    while (k <= (unsigned)n) {
+        __builtin_prefetch(keys + 16 * (size_t)k);
+        k = 2 * k + (keys[k] < key);
+    }
+    k >>= __builtin_ctz(~k) + 1;
+    return k != 0 && keys[k] == key ? rank[k] : -1;
+}
+
+// ---------- prepared search ----------
+
+enum SearchStrategy {
+    SEARCH_LINEAR,
+    SEARCH_BINARY,
+    SEARCH_INTERPOLATION,
+    SEARCH_EXPONENTIAL,
+    SEARCH_EYTZINGER,
+    STRATEGY_COUNT
+};
+
+static const char* strategyNames[STRATEGY_COUNT] = {
+    "linear", "branchless binary", "interpolation", "exponential", "eytzinger index"
+};
+
+// A sorted array plus what was learned about it. The array is referenced,
+// not copied, and must not change while the object is in use.
+struct PreparedSearch {
+    int* arr;
+    int n;
+
+    // Profile
+    size_t bytes;
+    long l2Bytes;
+    double interpolationError;   // Mean |predicted - actual| / n of one global line
+    double duplicateRatio;       // Fraction of sampled neighbours that are equal
+
+    enum SearchStrategy heuristic;   // What the profile alone suggests
+    enum SearchStrategy strategy;    // What preparedSearch uses
+    double costNs[STRATEGY_COUNT];   // From calibration; negative if not measured
+    int calibrated;
+
+    int* eytzingerKeys;              // Built only when the index is in use
+    int* eytzingerRank;
+};
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t nextRandom(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+static long l2CacheBytes() {
+#ifdef _SC_LEVEL2_CACHE_SIZE
+    long bytes = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    if (bytes > 0) return bytes;
+#endif
+    return DEFAULT_L2;
+}
+
+// Evenly spaced samples: how far the line through the first and last key
+// puts each sample from its real position (interpolation search's
+// assumption), and how often a key equals its neighbour
+static void profileArray(struct PreparedSearch* ps) {
+    int n = ps->n;
+    ps->bytes = (size_t)n * sizeof(int);
+    ps->l2Bytes = l2CacheBytes();
+    ps->interpolationError = 0;
+    ps->duplicateRatio = 0;
+    if (n < 2) return;
+
+    double range = (double)ps->arr[n - 1] - ps->arr[0];
+    int samples = n - 1 < PROFILE_SAMPLES ? n - 1 : PROFILE_SAMPLES;
+    double error = 0;
+    int equal = 0;
+    for (int s = 0; s < samples; s++) {
+        int i = (int)((double)s * (n - 1) / samples);
+        double predicted = range > 0 ? ((double)ps->arr[i] - ps->arr[0]) / range * (n - 1) : 0;
+        error += fabs(predicted - i);
+        equal += ps->arr[i] == ps->arr[i + 1];
+    }
+    ps->interpolationError = error / samples / n;
+    ps->duplicateRatio = (double)equal / samples;
+}
+
+// The rule of thumb the calibration starts from:
+//   tiny arrays are scanned;
+//   near-uniform keys without many duplicates take O(log log n) probes
+//   with interpolation;
+//   arrays larger than L2 get the Eytzinger index, whose prefetch hides
+//   the cache misses a plain binary search waits for;
+//   everything else uses branchless binary search
+static enum SearchStrategy chooseByProfile(const struct PreparedSearch* ps) {
+    if (ps->n <= LINEAR_MAX) return SEARCH_LINEAR;
+    if (ps->interpolationError < 0.001 && ps->duplicateRatio < 0.05) return SEARCH_INTERPOLATION;
+    if ((long)ps->bytes > ps->l2Bytes) return SEARCH_EYTZINGER;
+    return SEARCH_BINARY;
+}
+
+static void buildEytzinger(struct PreparedSearch* ps) {
+    if (ps->eytzingerKeys) return;
+    size_t bytes = ((size_t)(ps->n + 1) * sizeof(int) + 63) / 64 * 64;
+    ps->eytzingerKeys = (int*)aligned_alloc(64, bytes);
+    ps->eytzingerRank = (int*)malloc((size_t)(ps->n + 1) * sizeof(int));
+    fillEytzinger(ps->eytzingerKeys, ps->eytzingerRank, ps->n, ps->arr, 0, 1);
+}
+
+static void dropEytzinger(struct PreparedSearch* ps) {
+    free(ps->eytzingerKeys);
+    free(ps->eytzingerRank);
+    ps->eytzingerKeys = NULL;
+    ps->eytzingerRank = NULL;
+}
+
+static int searchWith(const struct PreparedSearch* ps, enum SearchStrategy strategy, int x) {
+    switch (strategy) {
+        case SEARCH_LINEAR: return linearSearch(ps->arr, ps->n, x);
+        case SEARCH_INTERPOLATION: return interpolationSearch(ps->arr, ps->n, x);
+        case SEARCH_EXPONENTIAL: return exponentialSearch(ps->arr, ps->n, x);
+        case SEARCH_EYTZINGER: return eytzingerSearch(ps->eytzingerKeys, ps->eytzingerRank, ps->n, x);
+        default: return branchlessSearch(ps->arr, ps->n, x);
+    }
+}
+
+// Same contract as binarySearch: an index holding x, or -1
+int preparedSearch(const struct PreparedSearch* ps, int x) {
+    if (ps->n == 0) return -1;
+    return searchWith(ps, ps->strategy, x);
+}
+
+// Times every strategy on the given queries and switches to the fastest.
+// Each strategy gets CALIBRATION_BUDGET seconds, so interpolation on
+// skewed keys is cut short rather than stalling the build; a linear scan
+// is not even tried past LINEAR_CALIBRATION_MAX keys. Pass the real
+// workload when it is known: only then can exponential search, which wins
+// when hits sit near the front, show it.
+static volatile long calibrationSink;   // Keeps the timed searches from being optimized away
+
+void calibratePreparedSearch(struct PreparedSearch* ps, const int queries[], int count) {
+    if (ps->n == 0 || count <= 0) return;
+    buildEytzinger(ps);
+    long checksum = 0;
+    for (int s = 0; s < STRATEGY_COUNT; s++) {
+        ps->costNs[s] = -1;
+        if (s == SEARCH_LINEAR && ps->n > LINEAR_CALIBRATION_MAX) continue;
+        // Warm-up pass over a few queries, then the timed one
+        for (int q = 0; q < count && q < 16; q++) {
+            checksum += searchWith(ps, (enum SearchStrategy)s, queries[q]);
+        }
+        double start = nowSeconds();
+        int done = 0;
+        while (done < count && (done % 16 != 0 || nowSeconds() - start < CALIBRATION_BUDGET)) {
+            checksum += searchWith(ps, (enum SearchStrategy)s, queries[done++]);
+        }
+        ps->costNs[s] = (nowSeconds() - start) * 1e9 / done;
+    }
+    calibrationSink = checksum;
+
+    int best = SEARCH_BINARY;
+    for (int s = 0; s < STRATEGY_COUNT; s++) {
+        if (ps->costNs[s] >= 0 && ps->costNs[s] < ps->costNs[best]) best = s;
+    }
+    ps->strategy = (enum SearchStrategy)best;
+    ps->calibrated = 1;
+    if (ps->strategy != SEARCH_EYTZINGER) dropEytzinger(ps);
+}
+
+// Profiles arr once and picks a strategy. With calibrate set, the choice is
+// confirmed by timing every strategy on synthetic queries: half of them
+// keys from the array, half uniform over its range.
+struct PreparedSearch* createPreparedSearch(int arr[], int n, int calibrate) {
+    struct PreparedSearch* ps = (struct PreparedSearch*)calloc(1, sizeof(struct PreparedSearch));
+    ps->arr = arr;
+    ps->n = n;
+    for (int s = 0; s < STRATEGY_COUNT; s++) ps->costNs[s] = -1;
+    profileArray(ps);
+    ps->heuristic = ps->strategy = chooseByProfile(ps);
+
+    if (calibrate && n > 0) {
+        int* queries = (int*)malloc(CALIBRATION_QUERIES * sizeof(int));
+        uint32_t state = 0x9E3779B9u;
+        uint32_t span = (uint32_t)((long)arr[n - 1] - arr[0] + 1);
+        for (int q = 0; q < CALIBRATION_QUERIES; q++) {
+            queries[q] = q % 2 ? arr[nextRandom(&state) % n]
+                               : (int)((long)arr[0] + (span ? nextRandom(&state) % span : 0));
+        }
+        calibratePreparedSearch(ps, queries, CALIBRATION_QUERIES);
+        free(queries);
+    }
+    if (ps->strategy == SEARCH_EYTZINGER) buildEytzinger(ps);
+    return ps;
+}
+
+void freePreparedSearch(struct PreparedSearch* ps) {
+    dropEytzinger(ps);
+    free(ps);
+}
+
+const char* preparedSearchStrategy(const struct PreparedSearch* ps) {
+    return strategyNames[ps->strategy];
+}
+
+// One line for logs: the profile, the rule-of-thumb pick, and what
+// calibration measured
+void describePreparedSearch(const struct PreparedSearch* ps, char* buf, size_t size) {
+    int len = snprintf(buf, size, "n=%d %.1f KB (L2 %ld KB) interp-err=%.2g dup=%.0f%% rule=%s use=%s",
+                       ps->n, ps->bytes / 1024.0, ps->l2Bytes / 1024, ps->interpolationError,
+                       ps->duplicateRatio * 100, strategyNames[ps->heuristic], strategyNames[ps->strategy]);
+    if (!ps->calibrated) return;
+    for (int s = 0; s < STRATEGY_COUNT && len > 0 && (size_t)len < size; s++) {
+        if (ps->costNs[s] < 0) {
+            len += snprintf(buf + len, size - len, "%s%s -", s == 0 ? " [" : ", ", strategyNames[s]);
+        } else {
+            len += snprintf(buf + len, size - len, "%s%s %.0fns", s == 0 ? " [" : ", ",
+                            strategyNames[s], ps->costNs[s]);
+        }
+    }
+    if (len > 0 && (size_t)len < size) snprintf(buf + len, size - len, "]");
+}
+
+// ---------- benchmark ----------
+
+static int compareInts(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// 0 tiny, 1 uniform, 2 lognormal (skewed), 3 heavy duplicates
+static void fillKeys(int arr[], int n, int shape, uint32_t* state) {
+    for (int i = 0; i < n; i++) {
+        if (shape == 2) {
+            double u1 = (nextRandom(state) + 0.5) / 4294967296.0;
+            double u2 = (nextRandom(state) + 0.5) / 4294967296.0;
+            double v = exp(2.0 * sqrt(-2 * log(u1)) * cos(6.283185307179586 * u2)) * 1e5;
+            arr[i] = v >= INT_MAX ? INT_MAX : (int)v;
+        } else if (shape == 3) {
+            arr[i] = (int)(nextRandom(state) % 1000);
+        } else {
+            arr[i] = (int)(nextRandom(state) % INT_MAX);
+        }
+    }
+    qsort(arr, n, sizeof(int), compareInts);
+}
+
+int main(int argc, char* argv[]) {
+    int arr[] = {2, 3, 4, 10, 40, 50, 60};
+    int n = sizeof(arr) / sizeof(arr[0]);
+    int x = 10;
+
+    struct PreparedSearch* ps = createPreparedSearch(arr, n, 0);
+    int result = preparedSearch(ps, x);
+    if (result != -1) {
+        printf("Element found at index %d (using %s)\n", result, preparedSearchStrategy(ps));
+    } else {
+        printf("Element not found\n");
+    }
+    freePreparedSearch(ps);
+
+    // Each case: array size, key shape, and whether the queries cluster at
+    // the front of the array. argv[1] caps the largest size.
+    int maxSize = argc > 1 ? atoi(argv[1]) : 1 << 24;
+    struct { const char* name; int size; int shape; int frontQueries; } cases[] = {
+        {"tiny", 24, 1, 0},
+        {"uniform, in cache", 1 << 14, 1, 0},
+        {"uniform, large", 1 << 24, 1, 0},
+        {"lognormal, in cache", 1 << 16, 2, 0},
+        {"lognormal, large", 1 << 24, 2, 0},
+        {"1000 distinct keys", 1 << 20, 3, 0},
+        {"hits near the front", 1 << 20, 1, 1},
+    };
+    int lookups = 200000;
+    int* queries = (int*)malloc(lookups * sizeof(int));
+    char line[512];
+    long checksum = 0;
+
+    for (int c = 0; c < (int)(sizeof(cases) / sizeof(cases[0])); c++) {
+        int size = cases[c].size < maxSize ? cases[c].size : maxSize;
+        int* keys = (int*)malloc((size_t)size * sizeof(int));
+        uint32_t state = 31 + c;
+        fillKeys(keys, size, cases[c].shape, &state);
+        for (int q = 0; q < lookups; q++) {
+            int pos = cases[c].frontQueries ? (int)(nextRandom(&state) % 64) : (int)(nextRandom(&state) % size);
+            // Odd queries hit; even ones miss just above a key, unless it
+            // was clamped to INT_MAX and there is nothing above it
+            queries[q] = q % 2 || keys[pos] == INT_MAX ? keys[pos] : keys[pos] + 1;
+        }
+
+        double start = nowSeconds();
+        ps = createPreparedSearch(keys, size, 1);
+        // A known workload is the better calibration input
+        if (cases[c].frontQueries) calibratePreparedSearch(ps, queries, CALIBRATION_QUERIES);
+        double buildMs = (nowSeconds() - start) * 1e3;
+        describePreparedSearch(ps, line, sizeof(line));
+        printf("\n%s (prepared in %.1f ms)\n  %s\n", cases[c].name, buildMs, line);
+
+        // Every strategy must agree with binarySearch on found / not found
+        int ok = 1;
+        for (int q = 0; q < 2000; q++) {
+            int r = preparedSearch(ps, queries[q]);
+            int expected = binarySearch(keys, 0, size - 1, queries[q]);
+            if ((r == -1) != (expected == -1) || (r != -1 && keys[r] != queries[q])) ok = 0;
+        }
+
+        start = nowSeconds();
+        for (int q = 0; q < lookups; q++) checksum += preparedSearch(ps, queries[q]);
+        double prepared = (nowSeconds() - start) * 1e9 / lookups;
+        start = nowSeconds();
+        for (int q = 0; q < lookups; q++) checksum += binarySearch(keys, 0, size - 1, queries[q]);
+        double binary = (nowSeconds() - start) * 1e9 / lookups;
+        printf("  %d lookups: prepared %.1f ns, binarySearch %.1f ns%s\n",
+               lookups, prepared, binary, ok ? "" : "  MISMATCH");
+
+        freePreparedSearch(ps);
+        free(keys);
+    }
+    printf("(checksum %ld)\n", checksum);
+
+    free(queries);
+    return 0;
+}
@@ -0,0 +1,183 @@
+// Batched Binary Search (many keys, interleaved probes)
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#define MAX_BATCH 64
+
+// The original binary search from binary_search.c
+int binarySearch(int arr[], int left, int right, int key) {
+    while (left <= right) {
+        int mid = left + (right - left) / 2;
+
+        if (arr[mid] == key) {
+            return mid;
+        }
+
+        if (arr[mid] < key) {
+            left = mid + 1;
+        } else {
+            right = mid - 1;
+        }
+    }
+
+    return -1;
+}
+
+// ---------- interleaved batch ----------
+
+// Searches `batch` keys in lockstep. The branchless search's window length
+// depends only on n, so every key is at the same step: one pass of the
+// inner loop issues a probe per key, and the prefetch of each key's next
+// probe lets up to `batch` cache misses overlap instead of one at a time.
+static void searchGroup(const int arr[], int n, const int keys[], int batch, int out[]) {
+    const int* base[MAX_BATCH];
+    for (int g = 0; g < batch; g++) base[g] = arr;
+
+    int len = n;
+    while (len > 1) {
+        int half = len / 2;
+        len -= half;
+        for (int g = 0; g < batch; g++) {
+            base[g] += (base[g][half - 1] < keys[g]) * half;
+            __builtin_prefetch(&base[g][len / 2 - 1]);
+        }
+    }
+    for (int g = 0; g < batch; g++) {
+        int i = (int)(base[g] - arr) + (*base[g] < keys[g]);
+        out[g] = i < n && arr[i] == keys[g] ? i : -1;
+    }
+}
+
+// out[i] = index of keys[i] in arr, or -1, like binarySearch per key.
+// batch keys are in flight at once; 16-32 covers DRAM latency.
+void binarySearchBatch(const int arr[], int n, const int keys[], int count, int out[], int batch) {
+    if (n == 0) {
+        for (int i = 0; i < count; i++) out[i] = -1;
+        return;
+    }
+    if (batch < 1) batch = 1;
+    if (batch > MAX_BATCH) batch = MAX_BATCH;
+    for (int i = 0; i < count; i += batch) {
+        searchGroup(arr, n, keys + i, count - i < batch ? count - i : batch, out + i);
+    }
+}
+
+// ---------- sorted query batch ----------
+
+// For keys in ascending order, each answer is a lower bound for the next:
+// gallop forward from the previous position (1, 2, 4, ... elements), then
+// binary search the last gap. Dense batches touch each line about once.
+void binarySearchSortedBatch(const int arr[], int n, const int keys[], int count, int out[]) {
+    int pos = 0;
+    for (int i = 0; i < count; i++) {
+        int key = keys[i];
+        int lo = pos, step = 1;
+        while (lo + step < n && arr[lo + step] < key) {
+            lo += step;
+            step *= 2;
+        }
+        int hi = lo + step < n ? lo + step : n;
+
+        // First index in [lo, hi] with arr[index] >= key
+        while (lo < hi) {
+            int mid = lo + (hi - lo) / 2;
+            if (arr[mid] < key) lo = mid + 1;
+            else hi = mid;
+        }
+        pos = lo;
+        out[i] = lo < n && arr[lo] == key ? lo : -1;
+    }
+}
+
+// ---------- benchmark ----------
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t nextRandom(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+static int compareInts(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+static long sum(const int out[], int count) {
+    long total = 0;
+    for (int i = 0; i < count; i++) total += out[i];
+    return total;
+}
+
+int main(int argc, char* argv[]) {
+    int arr[] = {2, 3, 4, 10, 40, 50, 60};
+    int n = sizeof(arr) / sizeof(arr[0]);
+    int keys[] = {10, 5, 60, 2};
+    int out[4];
+
+    binarySearchBatch(arr, n, keys, 4, out, 4);
+    for (int i = 0; i < 4; i++) {
+        if (out[i] != -1) printf("%d found at index %d\n", keys[i], out[i]);
+        else printf("%d not found\n", keys[i]);
+    }
+
+    int size = argc > 1 ? atoi(argv[1]) : 1 << 26;
+    int count = argc > 2 ? atoi(argv[2]) : 4000000;
+    int* sorted = (int*)malloc((size_t)size * sizeof(int));
+    int* queries = (int*)malloc(count * sizeof(int));
+    int* expected = (int*)malloc(count * sizeof(int));
+    int* results = (int*)malloc(count * sizeof(int));
+
+    for (int i = 0; i < size; i++) sorted[i] = 2 * i;   // Even keys: half the queries miss
+    uint32_t state = 12345;
+    for (int q = 0; q < count; q++) queries[q] = (int)(nextRandom(&state) % (2u * size));
+
+    printf("\n%d lookups in %d sorted ints (%d MB)\n", count, size, (int)((long)size * 4 >> 20));
+    printf("%-24s %10s %12s %8s\n", "method", "ns/lookup", "Mlookups/s", "speedup");
+
+    double start = nowSeconds();
+    for (int q = 0; q < count; q++) expected[q] = binarySearch(sorted, 0, size - 1, queries[q]);
+    double baseline = (nowSeconds() - start) * 1e9 / count;
+    printf("%-24s %10.1f %12.2f %7.2fx\n", "binarySearch per key", baseline, 1e3 / baseline, 1.0);
+
+    const int batches[] = {1, 4, 8, 16, 32, 64};
+    for (int b = 0; b < 6; b++) {
+        start = nowSeconds();
+        binarySearchBatch(sorted, size, queries, count, results, batches[b]);
+        double ns = (nowSeconds() - start) * 1e9 / count;
+        char label[32];
+        snprintf(label, sizeof(label), "batch of %d", batches[b]);
+        int ok = memcmp(results, expected, count * sizeof(int)) == 0;
+        printf("%-24s %10.1f %12.2f %7.2fx%s\n", label, ns, 1e3 / ns, baseline / ns, ok ? "" : "  MISMATCH");
+    }
+
+    // The sorted path needs ascending keys; the sort is timed separately
+    start = nowSeconds();
+    qsort(queries, count, sizeof(int), compareInts);
+    double sortNs = (nowSeconds() - start) * 1e9 / count;
+    for (int q = 0; q < count; q++) expected[q] = binarySearch(sorted, 0, size - 1, queries[q]);
+
+    start = nowSeconds();
+    binarySearchSortedBatch(sorted, size, queries, count, results);
+    double ns = (nowSeconds() - start) * 1e9 / count;
+    int ok = memcmp(results, expected, count * sizeof(int)) == 0;
+    printf("%-24s %10.1f %12.2f %7.2fx%s\n", "sorted batch (gallop)", ns, 1e3 / ns, baseline / ns, ok ? "" : "  MISMATCH");
+    printf("%-24s %10.1f\n", "  + sorting the queries", sortNs);
+    printf("(checksum %ld)\n", sum(results, count));
+
+    free(sorted);
+    free(queries);
+    free(expected);
+    free(results);
+    return 0;
+}
@@ -0,0 +1,225 @@
+// Eytzinger Layout and Branchless Binary Search
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#define CACHE_LINE 64
+#define LOOKUPS 1000000
+
+// The original binary search from binary_search.c
+int binarySearch(int arr[], int left, int right, int key) {
+    while (left <= right) {
+        int mid = left + (right - left) / 2;
+
+        if (arr[mid] == key) {
+            return mid;
+        }
+
+        if (arr[mid] < key) {
+            left = mid + 1;
+        } else {
+            right = mid - 1;
+        }
+    }
+
+    return -1;
+}
+
+// ---------- branchless search on the sorted array ----------
+
+// Index of the first element >= key (n if none). The loop runs exactly
+// ceil(log2 n) times and the compare feeds a conditional move, so nothing
+// is left to mispredict. Both candidates for the next probe are
+// prefetched while the current one loads.
+int branchlessLowerBound(const int arr[], int n, int key) {
+    if (n == 0) return 0;
+    const int* base = arr;
+    int len = n;
+    while (len > 1) {
+        int half = len / 2;
+        len -= half;
+        __builtin_prefetch(&base[len / 2 - 1]);
+        __builtin_prefetch(&base[half + len / 2 - 1]);
+        base += (base[half - 1] < key) * half;
+    }
+    return (int)(base - arr) + (*base < key);
+}
+
+// ---------- Eytzinger layout ----------
+
+// The sorted keys stored as an implicit BFS tree: the root at 1 and the
+// children of k at 2k and 2k+1. The first four levels share a few cache
+// lines, and the 16 descendants four levels below k sit in one line.
+struct EytzingerArray {
+    int* keys;    // keys[1..n]; keys[0] unused
+    int* rank;    // rank[k] = position of keys[k] in the sorted array
+    int n;
+};
+
+// In-order walk of the implicit tree hands out the sorted keys in order
+static int fillEytzinger(struct EytzingerArray* e, const int sorted[], int i, size_t k) {
+    if (k <= (size_t)e->n) {
+        i = fillEytzinger(e, sorted, i, 2 * k);
+        e->keys[k] = sorted[i];
+        e->rank[k] = i;
+        i++;
+        i = fillEytzinger(e, sorted, i, 2 * k + 1);
+    }
+    return i;
+}
+
+// One-time O(n) conversion; keys is cache-line aligned so the prefetch
+// below covers exactly one line
+struct EytzingerArray* createEytzinger(const int sorted[], int n) {
+    struct EytzingerArray* e = (struct EytzingerArray*)malloc(sizeof(struct EytzingerArray));
+    size_t bytes = ((size_t)(n + 1) * sizeof(int) + CACHE_LINE - 1) / CACHE_LINE * CACHE_LINE;
+    e->keys = (int*)aligned_alloc(CACHE_LINE, bytes);
+    e->rank = (int*)malloc((size_t)(n + 1) * sizeof(int));
+    e->n = n;
+    e->rank[0] = n;   // Index 0 stands for "past the end"
+    fillEytzinger(e, sorted, 0, 1);
+    return e;
+}
+
+void freeEytzinger(struct EytzingerArray* e) {
+    free(e->keys);
+    free(e->rank);
+    free(e);
+}
+
+// Eytzinger index of the first key >= key, or 0 if none. Descending
+// right on keys[k] < key and left otherwise, the path's last left turn is
+// the answer: the trailing 1 bits of k are the right turns after it.
+// k runs up to 2n + 1, past INT_MAX at n = 2^30, so it is unsigned.
+int eytzingerLowerBound(const struct EytzingerArray* e, int key) {
+    const int* b = e->keys;
+    unsigned k = 1;
+    while (k <= (unsigned)e->n) {
+        __builtin_prefetch(b + 16 * (size_t)k);   // Descendants 4 levels down
+        k = 2 * k + (b[k] < key);
+    }
+    return (int)(k >> (__builtin_ctz(~k) + 1));
+}
+
+// Same loop without the prefetch, to show what it buys
+static int eytzingerLowerBoundNoPrefetch(const struct EytzingerArray* e, int key) {
+    const int* b = e->keys;
+    unsigned k = 1;
+    while (k <= (unsigned)e->n) {
+        k = 2 * k + (b[k] < key);
+    }
+    return (int)(k >> (__builtin_ctz(~k) + 1));
+}
+
+// Same contract as binarySearch: sorted index of key, or -1
+int eytzingerSearch(const struct EytzingerArray* e, int key) {
+    int k = eytzingerLowerBound(e, key);
+    return k != 0 && e->keys[k] == key ? e->rank[k] : -1;
+}
+
+// ---------- benchmark ----------
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t nextRandom(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+// Every result is summed into a checksum so no loop can be optimized away
+static double timeBinarySearch(int arr[], int n, const int queries[], long* checksum) {
+    double start = nowSeconds();
+    for (int q = 0; q < LOOKUPS; q++) *checksum += binarySearch(arr, 0, n - 1, queries[q]);
+    return (nowSeconds() - start) * 1e9 / LOOKUPS;
+}
+
+static double timeBranchless(const int arr[], int n, const int queries[], long* checksum) {
+    double start = nowSeconds();
+    for (int q = 0; q < LOOKUPS; q++) *checksum += branchlessLowerBound(arr, n, queries[q]);
+    return (nowSeconds() - start) * 1e9 / LOOKUPS;
+}
+
+static double timeEytzinger(const struct EytzingerArray* e, int (*lowerBound)(const struct EytzingerArray*, int),
+                            const int queries[], long* checksum) {
+    double start = nowSeconds();
+    for (int q = 0; q < LOOKUPS; q++) *checksum += lowerBound(e, queries[q]);
+    return (nowSeconds() - start) * 1e9 / LOOKUPS;
+}
+
+// lower_bound on every path agrees with a plain reference
+static int verify(const int arr[], int n, const struct EytzingerArray* e, const int queries[]) {
+    for (int q = 0; q < 10000; q++) {
+        int key = queries[q];
+        int lo = 0, hi = n;
+        while (lo < hi) {
+            int mid = lo + (hi - lo) / 2;
+            if (arr[mid] < key) lo = mid + 1;
+            else hi = mid;
+        }
+        if (branchlessLowerBound(arr, n, key) != lo) return 0;
+        if (e->rank[eytzingerLowerBound(e, key)] != lo) return 0;
+        int found = eytzingerSearch(e, key);
+        if (found != -1 && arr[found] != key) return 0;
+        if (found == -1 && lo < n && arr[lo] == key) return 0;
+    }
+    return 1;
+}
+
+int main(int argc, char* argv[]) {
+    int arr[] = {2, 3, 4, 10, 40, 50, 60};
+    int n = sizeof(arr) / sizeof(arr[0]);
+    int key = 10;
+
+    struct EytzingerArray* e = createEytzinger(arr, n);
+    printf("Eytzinger layout: ");
+    for (int k = 1; k <= n; k++) printf("%d ", e->keys[k]);
+    printf("\n");
+
+    int result = eytzingerSearch(e, key);
+    if (result != -1) {
+        printf("Element found at index %d\n", result);
+    } else {
+        printf("Element not found\n");
+    }
+    freeEytzinger(e);
+
+    // Sizes 1K to 1G by powers of 4; argv[1] caps them (1G needs ~12 GB)
+    long maxSize = argc > 1 ? atol(argv[1]) : 1L << 26;
+    int* queries = (int*)malloc(LOOKUPS * sizeof(int));
+    long checksum = 0;
+
+    printf("\nns per lookup, %d random lookups\n", LOOKUPS);
+    printf("%12s %12s %12s %12s %12s\n", "n", "binary", "branchless", "eytzinger", "no prefetch");
+    for (long size = 1024; size <= maxSize && size <= (1L << 30); size *= 4) {
+        int* sorted = (int*)malloc((size_t)size * sizeof(int));
+        for (long i = 0; i < size; i++) sorted[i] = (int)(2 * i);   // Even keys: half the lookups miss
+        uint32_t state = 12345;
+        for (int q = 0; q < LOOKUPS; q++) queries[q] = (int)(nextRandom(&state) % (uint32_t)(2 * size));
+
+        e = createEytzinger(sorted, (int)size);
+        int ok = verify(sorted, (int)size, e, queries);
+
+        double binary = timeBinarySearch(sorted, (int)size, queries, &checksum);
+        double branchless = timeBranchless(sorted, (int)size, queries, &checksum);
+        double eytzinger = timeEytzinger(e, eytzingerLowerBound, queries, &checksum);
+        double noPrefetch = timeEytzinger(e, eytzingerLowerBoundNoPrefetch, queries, &checksum);
+        printf("%12ld %12.1f %12.1f %12.1f %12.1f%s\n",
+               size, binary, branchless, eytzinger, noPrefetch, ok ? "" : "  MISMATCH");
+
+        freeEytzinger(e);
+        free(sorted);
+    }
+    printf("(checksum %ld)\n", checksum);
+
+    free(queries);
+    return 0;
+}
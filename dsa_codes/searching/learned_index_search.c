@@ -0,0 +1,343 @@
+// Learned Index (piecewise-linear model with error bound epsilon)
+// Build: gcc -O2 learned_index_search.c -lm
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <limits.h>
+#include <math.h>
+#include <time.h>
+
+#define MAX_LEVELS 16
+#define LOOKUPS 1000000
+#define INTERPOLATION_BUDGET 2.0   // Seconds
+
+// The original searches, for comparison
+int binarySearch(int arr[], int left, int right, int key) {
+    while (left <= right) {
+        int mid = left + (right - left) / 2;
+
+        if (arr[mid] == key) {
+            return mid;
+        }
+
+        if (arr[mid] < key) {
+            left = mid + 1;
+        } else {
+            right = mid - 1;
+        }
+    }
+
+    return -1;
+}
+
+// interpolationSearch from interpolation_search.c, plus a guard for
+// arr[hi] == arr[lo]: the original divides by zero on a run of duplicates
+int interpolationSearch(int arr[], int n, int x) {
+    int lo = 0, hi = (n - 1);
+
+    while (lo <= hi && x >= arr[lo] && x <= arr[hi]) {
+        if (lo == hi || arr[hi] == arr[lo]) {
+            if (arr[lo] == x) return lo;
+            return -1;
+        }
+
+        int pos = lo + (((double)(hi - lo) / ((double)arr[hi] - arr[lo])) * ((double)x - arr[lo]));
+
+        if (arr[pos] == x)
+            return pos;
+
+        if (arr[pos] < x)
+            lo = pos + 1;
+        else
+            hi = pos - 1;
+    }
+    return -1;
+}
+
+// ---------- model ----------
+
+// pos(x) ~= start + slope * (x - key) for keys from `key` up to the next
+// segment's key. Interpolation search uses one such line for the whole
+// array; here every segment is fitted so that no key is more than epsilon
+// positions from where its line puts it.
+struct Segment {
+    int key;
+    int start;
+    double slope;
+};
+
+// Level 0 models the keys; level l+1 models the first keys of level l's
+// segments, up to a single root segment, as in the PGM-index
+struct LearnedIndex {
+    const int* keys;
+    int n;
+    int epsilon;
+    struct Segment* segments;      // All levels, level 0 first
+    int* segmentKeys;              // segments[i].key, packed for searching
+    int levelStart[MAX_LEVELS + 1];
+    int levels;
+};
+
+// Greedy "shrinking cone": anchor a line at the segment's first point and
+// keep the range of slopes that puts every later point within epsilon.
+// When the range becomes empty the point starts a new segment. Each point
+// is looked at once, so a level is built in O(points). Only the first
+// occurrence of each key is a point, so duplicates cost nothing.
+static int fitSegments(const int x[], int count, int epsilon, struct Segment* out) {
+    int segments = 0;
+    int i = 0;
+    while (i < count) {
+        int key = x[i], start = i;
+        double slopeLo = 0, slopeHi = INFINITY;
+        int j = i + 1;
+        for (; j < count; j++) {
+            if (x[j] == x[j - 1]) continue;
+            double dx = (double)x[j] - key;
+            double lo = (j - epsilon - start) / dx;
+            double hi = (j + epsilon - start) / dx;
+            if (lo > slopeHi || hi < slopeLo) break;
+            if (lo > slopeLo) slopeLo = lo;
+            if (hi < slopeHi) slopeHi = hi;
+        }
+        out[segments].key = key;
+        out[segments].start = start;
+        out[segments].slope = isinf(slopeHi) ? 0 : (slopeLo + slopeHi) / 2;
+        segments++;
+        i = j;
+    }
+    return segments;
+}
+
+// First i in [0, n) with a[i] >= x (or a[i] > x when `upper`), given a
+// guess that is within epsilon of it. The window check and the galloping
+// outward only matter for keys absent from the set that fall behind a
+// long run of duplicates; everything else is one short binary search.
+static int boundedSearch(const int a[], int n, int x, int guess, int epsilon, int upper) {
+    int lo = guess - epsilon, hi = guess + epsilon + 1;
+    if (lo < 0) lo = 0;
+    if (hi > n) hi = n;
+    if (lo > hi) lo = hi;
+
+    int step = epsilon + 1;
+    while (lo > 0 && !(a[lo - 1] < x || (upper && a[lo - 1] == x))) {
+        hi = lo - 1;
+        lo = lo - step > 0 ? lo - step : 0;
+        step *= 2;
+    }
+    while (hi < n && (a[hi] < x || (upper && a[hi] == x))) {
+        lo = hi + 1;
+        hi = hi + step < n ? hi + step : n;
+        step *= 2;
+    }
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (a[mid] < x || (upper && a[mid] == x)) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+// Where segment s puts x, clamped to [s->start, end], the points the
+// segment covers
+static int predict(const struct Segment* s, int end, int x) {
+    double pos = s->start + s->slope * ((double)x - s->key);
+    if (pos < s->start) return s->start;
+    if (pos > end) return end;
+    return (int)pos;
+}
+
+// Fits all levels over a sorted array; the keys are referenced, not copied
+struct LearnedIndex* createLearnedIndex(const int sorted[], int n, int epsilon) {
+    struct LearnedIndex* idx = (struct LearnedIndex*)malloc(sizeof(struct LearnedIndex));
+    idx->keys = sorted;
+    idx->n = n;
+    idx->epsilon = epsilon;
+
+    // A segment covers at least two distinct points when epsilon >= 1, so
+    // each level is at most half the one below and 2n bounds them all
+    size_t capacity = 2 * (size_t)n + MAX_LEVELS;
+    idx->segments = (struct Segment*)malloc(capacity * sizeof(struct Segment));
+    idx->segmentKeys = (int*)malloc(capacity * sizeof(int));
+
+    const int* points = sorted;
+    int count = n, used = 0, level = 0;
+    idx->levelStart[0] = 0;
+    do {
+        int made = fitSegments(points, count, epsilon, idx->segments + used);
+        for (int i = 0; i < made; i++) idx->segmentKeys[used + i] = idx->segments[used + i].key;
+        points = idx->segmentKeys + used;
+        count = made;
+        used += made;
+        idx->levelStart[++level] = used;
+    } while (count > 1 && level < MAX_LEVELS);
+    idx->levels = level;
+
+    idx->segments = (struct Segment*)realloc(idx->segments, (used ? used : 1) * sizeof(struct Segment));
+    idx->segmentKeys = (int*)realloc(idx->segmentKeys, (used ? used : 1) * sizeof(int));
+    return idx;
+}
+
+void freeLearnedIndex(struct LearnedIndex* idx) {
+    free(idx->segments);
+    free(idx->segmentKeys);
+    free(idx);
+}
+
+size_t learnedIndexBytes(const struct LearnedIndex* idx) {
+    return (size_t)idx->levelStart[idx->levels] * (sizeof(struct Segment) + sizeof(int));
+}
+
+// First index with keys[index] >= x, or n. Each level's prediction is
+// corrected by a search over at most 2*epsilon+2 entries of the level
+// below, ending in the keys themselves.
+int learnedLowerBound(const struct LearnedIndex* idx, int x) {
+    if (idx->n == 0) return 0;
+    int s = idx->levelStart[idx->levels - 1];      // The root
+    for (int level = idx->levels - 1; level > 0; level--) {
+        int below = idx->levelStart[level - 1];
+        int count = idx->levelStart[level] - below;
+        int next = s + 1 < idx->levelStart[level + 1] ? idx->segments[s + 1].start : count;
+        int guess = predict(&idx->segments[s], next, x);
+        // The last segment below whose first key is <= x
+        int i = boundedSearch(idx->segmentKeys + below, count, x, guess, idx->epsilon, 1) - 1;
+        s = below + (i < 0 ? 0 : i);
+    }
+    int next = s + 1 < idx->levelStart[1] ? idx->segments[s + 1].start : idx->n;
+    int guess = predict(&idx->segments[s], next, x);
+    return boundedSearch(idx->keys, idx->n, x, guess, idx->epsilon, 0);
+}
+
+// Same contract as interpolationSearch: index of x, or -1
+int learnedSearch(const struct LearnedIndex* idx, int x) {
+    int i = learnedLowerBound(idx, x);
+    return i < idx->n && idx->keys[i] == x ? i : -1;
+}
+
+// ---------- benchmark ----------
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t nextRandom(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+static double nextUniform(uint32_t* state) {
+    return (nextRandom(state) + 0.5) / 4294967296.0;
+}
+
+// Box-Muller
+static double nextNormal(uint32_t* state) {
+    return sqrt(-2 * log(nextUniform(state))) * cos(6.283185307179586 * nextUniform(state));
+}
+
+static int compareInts(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+// Uniform over the int range; lognormal (heavy right tail, dense head with
+// many duplicates); and 64 tight clusters with empty space between them
+static void fillKeys(int arr[], int n, int shape, uint32_t* state) {
+    for (int i = 0; i < n; i++) {
+        double v;
+        if (shape == 0) {
+            v = nextRandom(state) % INT_MAX;
+        } else if (shape == 1) {
+            v = exp(2.0 * nextNormal(state)) * 1e5;
+        } else {
+            uint32_t cluster = nextRandom(state) % 64;
+            v = cluster * (INT_MAX / 64.0) + fabs(nextNormal(state)) * 2e5;
+        }
+        arr[i] = v >= INT_MAX ? INT_MAX : (int)v;
+    }
+    qsort(arr, n, sizeof(int), compareInts);
+}
+
+static int verify(const int sorted[], int n, const struct LearnedIndex* idx, const int queries[]) {
+    for (int q = 0; q < 10000; q++) {
+        int x = queries[q];
+        int lo = 0, hi = n;
+        while (lo < hi) {
+            int mid = lo + (hi - lo) / 2;
+            if (sorted[mid] < x) lo = mid + 1;
+            else hi = mid;
+        }
+        if (learnedLowerBound(idx, x) != lo) return 0;
+    }
+    return 1;
+}
+
+int main(int argc, char* argv[]) {
+    int arr[] = { 10, 12, 13, 16, 18, 19, 20, 21, 22, 23, 24, 33, 35, 42, 47 };
+    int n = sizeof(arr) / sizeof(arr[0]);
+    int x = 18;
+
+    struct LearnedIndex* idx = createLearnedIndex(arr, n, 2);
+    int index = learnedSearch(idx, x);
+    if (index != -1)
+        printf("Element found at index %d\n", index);
+    else
+        printf("Element not found\n");
+    printf("%d keys, %d segments in %d levels\n", n, idx->levelStart[idx->levels], idx->levels);
+    freeLearnedIndex(idx);
+
+    int size = argc > 1 ? atoi(argv[1]) : 10000000;
+    const char* shapes[] = {"uniform", "lognormal", "clustered"};
+    const int epsilons[] = {8, 32, 128, 512};
+    int* sorted = (int*)malloc((size_t)size * sizeof(int));
+    int* queries = (int*)malloc(LOOKUPS * sizeof(int));
+    long checksum = 0;
+
+    printf("\n%d keys, %d lookups (half of them present)\n", size, LOOKUPS);
+    printf("%-10s %6s %9s %7s %10s %10s %10s\n", "keys", "eps", "segments", "levels", "model KB", "build ms", "ns/lookup");
+    for (int shape = 0; shape < 3; shape++) {
+        uint32_t state = 2024 + shape;
+        fillKeys(sorted, size, shape, &state);
+        for (int q = 0; q < LOOKUPS; q++) {
+            queries[q] = q % 2 ? sorted[nextRandom(&state) % size] : (int)(nextRandom(&state) % INT_MAX);
+        }
+
+        double start = nowSeconds();
+        for (int q = 0; q < LOOKUPS; q++) checksum += binarySearch(sorted, 0, size - 1, queries[q]);
+        printf("%-10s %6s %9s %7s %10s %10s %10.1f\n", shapes[shape], "-", "-", "-", "-", "binary",
+               (nowSeconds() - start) * 1e9 / LOOKUPS);
+
+        // On skewed keys interpolation search takes O(n) probes, so it
+        // gets a time budget instead of the full query set
+        start = nowSeconds();
+        int done = 0;
+        while (done < LOOKUPS && (done % 1024 != 0 || nowSeconds() - start < INTERPOLATION_BUDGET)) {
+            checksum += interpolationSearch(sorted, size, queries[done++]);
+        }
+        printf("%-10s %6s %9s %7s %10s %10s %10.1f\n", shapes[shape], "-", "1", "1", "0", "interp.",
+               (nowSeconds() - start) * 1e9 / done);
+
+        for (int e = 0; e < 4; e++) {
+            start = nowSeconds();
+            idx = createLearnedIndex(sorted, size, epsilons[e]);
+            double buildMs = (nowSeconds() - start) * 1e3;
+            int ok = verify(sorted, size, idx, queries);
+
+            start = nowSeconds();
+            for (int q = 0; q < LOOKUPS; q++) checksum += learnedSearch(idx, queries[q]);
+            double ns = (nowSeconds() - start) * 1e9 / LOOKUPS;
+            printf("%-10s %6d %9d %7d %10.1f %10.1f %10.1f%s\n", shapes[shape], epsilons[e],
+                   idx->levelStart[idx->levels], idx->levels, learnedIndexBytes(idx) / 1024.0,
+                   buildMs, ns, ok ? "" : "  MISMATCH");
+            freeLearnedIndex(idx);
+        }
+    }
+    printf("(checksum %ld)\n", checksum);
+
+    free(sorted);
+    free(queries);
+    return 0;
+}
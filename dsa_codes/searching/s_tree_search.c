@@ -0,0 +1,295 @@
+// Static S-tree (16-key nodes searched with AVX2)
+#define _POSIX_C_SOURCE 200809L
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <limits.h>
+#include <time.h>
+#include <sys/mman.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_X86 1
+#endif
+
+#define B 16                        // Keys per node: one 64-byte cache line
+#define MAX_LAYERS 10               // 17^9 leaves is past any int-sized n
+#define HUGE_PAGE (2 * 1024 * 1024)
+#define LOOKUPS 1000000
+
+// The original searches, for comparison
+int binarySearch(int arr[], int left, int right, int key) {
+    while (left <= right) {
+        int mid = left + (right - left) / 2;
+
+        if (arr[mid] == key) {
+            return mid;
+        }
+
+        if (arr[mid] < key) {
+            left = mid + 1;
+        } else {
+            right = mid - 1;
+        }
+    }
+
+    return -1;
+}
+
+int interpolationSearch(int arr[], int n, int x) {
+    int lo = 0, hi = (n - 1);
+
+    while (lo <= hi && x >= arr[lo] && x <= arr[hi]) {
+        if (lo == hi) {
+            if (arr[lo] == x) return lo;
+            return -1;
+        }
+
+        int pos = lo + (((double)(hi - lo) / (arr[hi] - arr[lo])) * (x - arr[lo]));
+
+        if (arr[pos] == x)
+            return pos;
+
+        if (arr[pos] < x)
+            lo = pos + 1;
+        else
+            hi = pos - 1;
+    }
+    return -1;
+}
+
+// ---------- S-tree ----------
+
+// A B+-tree with no pointers. The leaf layer is the sorted keys themselves
+// in 16-key nodes; above it, node k of a layer has children 17k .. 17k+16
+// in the layer below, and its key i is the smallest key under child i+1.
+// One lookup reads one cache line per layer, log17(n) + 1 in all: 8 lines
+// for 400M keys against 29 probes of binary search, and the answer is
+// leaf node * 16 + rank with no extra load.
+struct STree {
+    int (*nodes)[B];          // Root layer first, leaves last; INT_MAX padding
+    int offset[MAX_LAYERS];   // First node of each layer, root = layer 0
+    int layers;
+    int n;
+    size_t bytes;
+    int hugePages;
+};
+
+// Builds the index once from a sorted array. With hugePages the nodes sit
+// on 2 MB pages, so a lookup's few lines need far fewer TLB entries.
+struct STree* createSTree(const int sorted[], int n, int hugePages) {
+    struct STree* t = (struct STree*)malloc(sizeof(struct STree));
+    t->n = n;
+    t->hugePages = hugePages;
+
+    // Layer sizes from the leaves up, then offsets from the root down
+    int size[MAX_LAYERS];
+    int layers = 1;
+    size[0] = n > 0 ? (n + B - 1) / B : 1;
+    while (size[layers - 1] > 1) {
+        size[layers] = (size[layers - 1] + B) / (B + 1);
+        layers++;
+    }
+    t->layers = layers;
+    int numNodes = 0;
+    for (int h = 0; h < layers; h++) {
+        t->offset[h] = numNodes;
+        numNodes += size[layers - 1 - h];
+    }
+
+    size_t bytes = (size_t)numNodes * B * sizeof(int);
+    if (hugePages) {
+        t->bytes = (bytes + HUGE_PAGE - 1) / HUGE_PAGE * HUGE_PAGE;
+        t->nodes = (int (*)[B])aligned_alloc(HUGE_PAGE, t->bytes);
+#ifdef MADV_HUGEPAGE
+        madvise(t->nodes, t->bytes, MADV_HUGEPAGE);
+#endif
+    } else {
+        t->bytes = bytes;
+        t->nodes = (int (*)[B])aligned_alloc(64, t->bytes);
+    }
+
+    int* leaves = t->nodes[t->offset[layers - 1]];
+    for (long i = 0; i < (long)size[0] * B; i++) leaves[i] = i < n ? sorted[i] : INT_MAX;
+
+    // Key i of node k, d layers above the leaves: the first key of the
+    // leftmost leaf under child i+1
+    for (int d = 1; d < layers; d++) {
+        int* layer = t->nodes[t->offset[layers - 1 - d]];
+        for (long k = 0; k < size[d]; k++) {
+            for (int i = 0; i < B; i++) {
+                long leaf = k * (B + 1) + i + 1;
+                for (int up = 1; up < d && leaf < size[0]; up++) leaf *= B + 1;
+                layer[k * B + i] = leaf < size[0] ? leaves[leaf * B] : INT_MAX;
+            }
+        }
+    }
+    return t;
+}
+
+void freeSTree(struct STree* t) {
+    free(t->nodes);
+    free(t);
+}
+
+// Number of keys in the node smaller than x
+static int rankScalar(const int node[B], int x) {
+    int count = 0;
+    for (int i = 0; i < B; i++) count += node[i] < x;
+    return count;
+}
+
+#ifdef HAVE_X86
+// Two 8-lane compares, one movemask each: the popcount of the 16 bits is
+// the rank, with no branch per key
+__attribute__((target("avx2,popcnt")))
+static int rankAvx2(const int node[B], int x) {
+    __m256i key = _mm256_set1_epi32(x);
+    __m256i lo = _mm256_load_si256((const __m256i*)node);
+    __m256i hi = _mm256_load_si256((const __m256i*)(node + 8));
+    int maskLo = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(key, lo)));
+    int maskHi = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(key, hi)));
+    return __builtin_popcount(maskLo | (maskHi << 8));
+}
+#endif
+
+static int (*rankNode)(const int node[B], int x) = rankScalar;
+
+// Picks the AVX2 node search when the CPU has it
+void initSTree() {
+#ifdef HAVE_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) rankNode = rankAvx2;
+#endif
+}
+
+// Sorted index of the first key >= x, or n if there is none. An inner
+// node's rank is how many of its children start below x, so the answer
+// lies in that child; in the leaf, the rank is its offset.
+int sTreeLowerBound(const struct STree* t, int x) {
+    int k = 0;
+    for (int h = 0; h < t->layers - 1; h++) {
+        k = k * (B + 1) + rankNode(t->nodes[t->offset[h] + k], x);
+    }
+    int i = k * B + rankNode(t->nodes[t->offset[t->layers - 1] + k], x);
+    return i < t->n ? i : t->n;
+}
+
+// Same contract as binarySearch: sorted index of x, or -1. The leaf
+// just searched holds the key, so the check reads no new line.
+int sTreeSearch(const struct STree* t, int x) {
+    int i = sTreeLowerBound(t, x);
+    return i < t->n && t->nodes[t->offset[t->layers - 1] + i / B][i % B] == x ? i : -1;
+}
+
+// ---------- benchmark ----------
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t nextRandom(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+// Every path agrees with binarySearch, and lower_bound with a reference
+static int verify(int sorted[], int n, const struct STree* t, const int queries[]) {
+    for (int q = 0; q < 10000; q++) {
+        int x = queries[q];
+        int lo = 0, hi = n;
+        while (lo < hi) {
+            int mid = lo + (hi - lo) / 2;
+            if (sorted[mid] < x) lo = mid + 1;
+            else hi = mid;
+        }
+        if (sTreeLowerBound(t, x) != lo) return 0;
+        int found = sTreeSearch(t, x);
+        if ((found == -1) != (binarySearch(sorted, 0, n - 1, x) == -1)) return 0;
+    }
+    return 1;
+}
+
+int main(int argc, char* argv[]) {
+    int arr[] = {2, 3, 4, 10, 40, 50, 60};
+    int n = sizeof(arr) / sizeof(arr[0]);
+    int x = 10;
+
+    initSTree();
+    struct STree* tree = createSTree(arr, n, 0);
+    int index = sTreeSearch(tree, x);
+    if (index != -1)
+        printf("Element found at index %d\n", index);
+    else
+        printf("Element not found\n");
+    freeSTree(tree);
+
+    // Sizes 1K to 1G by powers of 4; argv[1] caps them (1G needs ~12 GB).
+    // Near-uniform keys (random gaps of 1-3, or 1 where that could pass
+    // INT_MAX) are interpolation search's best case. Clustered keys, runs
+    // of consecutive values split by rare huge gaps, are its bad case and
+    // cost the trees nothing. Half the queries hit, half are random.
+    long maxSize = argc > 1 ? atol(argv[1]) : 1L << 26;
+    int* queries = (int*)malloc(LOOKUPS * sizeof(int));
+    long checksum = 0;
+    const char* shapeNames[] = {"near-uniform keys", "clustered keys"};
+
+    for (int shape = 0; shape < 2; shape++) {
+        printf("\nns per lookup, %d random lookups, %s\n", LOOKUPS, shapeNames[shape]);
+        printf("%12s %10s %14s %10s %10s %10s\n", "n", "binary", "interpolation", "s-tree", "scalar", "huge pages");
+        for (long size = 1024; size <= maxSize && size <= (1L << 30); size *= 4) {
+            int* sorted = (int*)malloc((size_t)size * sizeof(int));
+            uint32_t state = 777;
+            long value = 0;
+            uint32_t maxGap = size < INT_MAX / 3 ? 3 : 1;
+            uint32_t bigGap = (uint32_t)(INT_MAX / 2 / (size / 1024 + 1));   // ~INT_MAX / 4 in all
+            for (long i = 0; i < size; i++) {
+                uint32_t r = nextRandom(&state);
+                if (shape == 0) value += 1 + r % maxGap;
+                else value += r % 1024 == 0 ? 1 + nextRandom(&state) % bigGap : 1;
+                sorted[i] = (int)(value < INT_MAX ? value : INT_MAX);
+            }
+            for (int q = 0; q < LOOKUPS; q++) {
+                uint32_t r = nextRandom(&state);
+                queries[q] = q % 2 ? sorted[r % size] : (int)(r % (uint32_t)(sorted[size - 1] + 1u));
+            }
+
+            struct STree* t = createSTree(sorted, (int)size, 0);
+            struct STree* huge = createSTree(sorted, (int)size, 1);
+            int ok = verify(sorted, (int)size, t, queries) && verify(sorted, (int)size, huge, queries);
+
+            double ns[5];
+            for (int m = 0; m < 5; m++) {
+                int (*saved)(const int[B], int) = rankNode;
+                if (m == 3) rankNode = rankScalar;
+                double start = nowSeconds();
+                for (int q = 0; q < LOOKUPS; q++) {
+                    int key = queries[q];
+                    switch (m) {
+                        case 0: checksum += binarySearch(sorted, 0, (int)size - 1, key); break;
+                        case 1: checksum += interpolationSearch(sorted, (int)size, key); break;
+                        case 2: checksum += sTreeSearch(t, key); break;
+                        case 3: checksum += sTreeSearch(t, key); break;
+                        default: checksum += sTreeSearch(huge, key); break;
+                    }
+                }
+                ns[m] = (nowSeconds() - start) * 1e9 / LOOKUPS;
+                rankNode = saved;
+            }
+            printf("%12ld %10.1f %14.1f %10.1f %10.1f %10.1f%s\n",
+                   size, ns[0], ns[1], ns[2], ns[3], ns[4], ok ? "" : "  MISMATCH");
+
+            freeSTree(t);
+            freeSTree(huge);
+            free(sorted);
+        }
+    }
+    printf("(checksum %ld)\n", checksum);
+
+    free(queries);
+    return 0;
+}
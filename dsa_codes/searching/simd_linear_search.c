@@ -0,0 +1,445 @@
+// SIMD Linear Search (SSE4.1 / AVX2 scans with runtime dispatch)
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_X86 1
+#endif
+
+#define MAX_NEEDLES 8
+#define CHUNK 1024          // Elements per bitmap chunk when building index lists
+
+// The original linear search from linear_search.c
+int linearSearch(int arr[], int n, int key) {
+    for (int i = 0; i < n; i++) {
+        if (arr[i] == key) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// ---------- kernels ----------
+//
+// Each instruction set provides the same four scans:
+//   find     index of the first arr[i] == key, or -1
+//   findAny  index of the first arr[i] equal to any of the needles, or -1
+//   count    number of arr[i] == key
+//   bitmap   bit i of bits[i / 32] set when arr[i] == key; returns the count
+
+struct ScanKernels {
+    const char* name;
+    int (*find)(const int arr[], int n, int key);
+    int (*findAny)(const int arr[], int n, const int needles[], int numNeedles);
+    int (*count)(const int arr[], int n, int key);
+    int (*bitmap)(const int arr[], int n, int key, uint32_t bits[]);
+};
+
+static int findScalar(const int arr[], int n, int key) {
+    for (int i = 0; i < n; i++) {
+        if (arr[i] == key) return i;
+    }
+    return -1;
+}
+
+static int findAnyScalar(const int arr[], int n, const int needles[], int numNeedles) {
+    for (int i = 0; i < n; i++) {
+        for (int k = 0; k < numNeedles; k++) {
+            if (arr[i] == needles[k]) return i;
+        }
+    }
+    return -1;
+}
+
+static int countScalar(const int arr[], int n, int key) {
+    int count = 0;
+    for (int i = 0; i < n; i++) count += arr[i] == key;
+    return count;
+}
+
+static int bitmapScalar(const int arr[], int n, int key, uint32_t bits[]) {
+    int count = 0;
+    for (int w = 0; w * 32 < n; w++) {
+        uint32_t word = 0;
+        int end = n - w * 32 < 32 ? n - w * 32 : 32;
+        for (int j = 0; j < end; j++) word |= (uint32_t)(arr[w * 32 + j] == key) << j;
+        bits[w] = word;
+        count += __builtin_popcount(word);
+    }
+    return count;
+}
+
+static const struct ScanKernels scalarKernels = {
+    "scalar", findScalar, findAnyScalar, countScalar, bitmapScalar
+};
+
+#ifdef HAVE_X86
+
+// SSE4.1: 4 lanes, 4 vectors (16 ints) per iteration. One PTEST on the OR
+// of the four compares decides whether to stop; only then is the exact
+// lane worked out.
+__attribute__((target("sse4.1")))
+static int findSse4(const int arr[], int n, int key) {
+    __m128i k = _mm_set1_epi32(key);
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i e0 = _mm_cmpeq_epi32(k, _mm_loadu_si128((const __m128i*)(arr + i)));
+        __m128i e1 = _mm_cmpeq_epi32(k, _mm_loadu_si128((const __m128i*)(arr + i + 4)));
+        __m128i e2 = _mm_cmpeq_epi32(k, _mm_loadu_si128((const __m128i*)(arr + i + 8)));
+        __m128i e3 = _mm_cmpeq_epi32(k, _mm_loadu_si128((const __m128i*)(arr + i + 12)));
+        __m128i any = _mm_or_si128(_mm_or_si128(e0, e1), _mm_or_si128(e2, e3));
+        if (!_mm_testz_si128(any, any)) {
+            uint32_t mask = _mm_movemask_ps(_mm_castsi128_ps(e0))
+                          | _mm_movemask_ps(_mm_castsi128_ps(e1)) << 4
+                          | _mm_movemask_ps(_mm_castsi128_ps(e2)) << 8
+                          | _mm_movemask_ps(_mm_castsi128_ps(e3)) << 12;
+            return i + __builtin_ctz(mask);
+        }
+    }
+    for (; i < n; i++) {
+        if (arr[i] == key) return i;
+    }
+    return -1;
+}
+
+__attribute__((target("sse4.1")))
+static int findAnySse4(const int arr[], int n, const int needles[], int numNeedles) {
+    __m128i k[MAX_NEEDLES];
+    for (int j = 0; j < numNeedles; j++) k[j] = _mm_set1_epi32(needles[j]);
+    int i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(arr + i));
+        __m128i hit = _mm_setzero_si128();
+        for (int j = 0; j < numNeedles; j++) hit = _mm_or_si128(hit, _mm_cmpeq_epi32(v, k[j]));
+        if (!_mm_testz_si128(hit, hit)) return i + __builtin_ctz(_mm_movemask_ps(_mm_castsi128_ps(hit)));
+    }
+    int rest = findAnyScalar(arr + i, n - i, needles, numNeedles);
+    return rest < 0 ? -1 : i + rest;
+}
+
+// cmpeq gives -1 per match, so subtracting it counts; four accumulators
+// keep the adds independent
+__attribute__((target("sse4.1")))
+static int countSse4(const int arr[], int n, int key) {
+    __m128i k = _mm_set1_epi32(key);
+    __m128i c0 = _mm_setzero_si128(), c1 = c0, c2 = c0, c3 = c0;
+    int i = 0;
+    for (; i + 16 <= n; i += 16) {
+        c0 = _mm_sub_epi32(c0, _mm_cmpeq_epi32(k, _mm_loadu_si128((const __m128i*)(arr + i))));
+        c1 = _mm_sub_epi32(c1, _mm_cmpeq_epi32(k, _mm_loadu_si128((const __m128i*)(arr + i + 4))));
+        c2 = _mm_sub_epi32(c2, _mm_cmpeq_epi32(k, _mm_loadu_si128((const __m128i*)(arr + i + 8))));
+        c3 = _mm_sub_epi32(c3, _mm_cmpeq_epi32(k, _mm_loadu_si128((const __m128i*)(arr + i + 12))));
+    }
+    __m128i c = _mm_add_epi32(_mm_add_epi32(c0, c1), _mm_add_epi32(c2, c3));
+    c = _mm_add_epi32(c, _mm_shuffle_epi32(c, 0x4E));
+    c = _mm_add_epi32(c, _mm_shuffle_epi32(c, 0xB1));
+    return _mm_cvtsi128_si32(c) + countScalar(arr + i, n - i, key);
+}
+
+__attribute__((target("sse4.1,popcnt")))
+static int bitmapSse4(const int arr[], int n, int key, uint32_t bits[]) {
+    __m128i k = _mm_set1_epi32(key);
+    int count = 0, i = 0;
+    for (; i + 32 <= n; i += 32) {
+        uint32_t word = 0;
+        for (int j = 0; j < 8; j++) {
+            __m128i e = _mm_cmpeq_epi32(k, _mm_loadu_si128((const __m128i*)(arr + i + 4 * j)));
+            word |= (uint32_t)_mm_movemask_ps(_mm_castsi128_ps(e)) << (4 * j);
+        }
+        bits[i / 32] = word;
+        count += __builtin_popcount(word);
+    }
+    return count + (i < n ? bitmapScalar(arr + i, n - i, key, bits + i / 32) : 0);
+}
+
+// AVX2: the same loops with 8 lanes, 32 ints per iteration
+__attribute__((target("avx2")))
+static int findAvx2(const int arr[], int n, int key) {
+    __m256i k = _mm256_set1_epi32(key);
+    int i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i e0 = _mm256_cmpeq_epi32(k, _mm256_loadu_si256((const __m256i*)(arr + i)));
+        __m256i e1 = _mm256_cmpeq_epi32(k, _mm256_loadu_si256((const __m256i*)(arr + i + 8)));
+        __m256i e2 = _mm256_cmpeq_epi32(k, _mm256_loadu_si256((const __m256i*)(arr + i + 16)));
+        __m256i e3 = _mm256_cmpeq_epi32(k, _mm256_loadu_si256((const __m256i*)(arr + i + 24)));
+        __m256i any = _mm256_or_si256(_mm256_or_si256(e0, e1), _mm256_or_si256(e2, e3));
+        if (!_mm256_testz_si256(any, any)) {
+            uint32_t mask = (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(e0))
+                          | (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(e1)) << 8
+                          | (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(e2)) << 16
+                          | (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(e3)) << 24;
+            return i + __builtin_ctz(mask);
+        }
+    }
+    for (; i + 8 <= n; i += 8) {
+        __m256i e = _mm256_cmpeq_epi32(k, _mm256_loadu_si256((const __m256i*)(arr + i)));
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(e));
+        if (mask) return i + __builtin_ctz(mask);
+    }
+    for (; i < n; i++) {
+        if (arr[i] == key) return i;
+    }
+    return -1;
+}
+
+__attribute__((target("avx2")))
+static int findAnyAvx2(const int arr[], int n, const int needles[], int numNeedles) {
+    __m256i k[MAX_NEEDLES];
+    for (int j = 0; j < numNeedles; j++) k[j] = _mm256_set1_epi32(needles[j]);
+    int i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(arr + i));
+        __m256i hit = _mm256_setzero_si256();
+        for (int j = 0; j < numNeedles; j++) hit = _mm256_or_si256(hit, _mm256_cmpeq_epi32(v, k[j]));
+        if (!_mm256_testz_si256(hit, hit)) return i + __builtin_ctz(_mm256_movemask_ps(_mm256_castsi256_ps(hit)));
+    }
+    int rest = findAnyScalar(arr + i, n - i, needles, numNeedles);
+    return rest < 0 ? -1 : i + rest;
+}
+
+__attribute__((target("avx2")))
+static int countAvx2(const int arr[], int n, int key) {
+    __m256i k = _mm256_set1_epi32(key);
+    __m256i c0 = _mm256_setzero_si256(), c1 = c0, c2 = c0, c3 = c0;
+    int i = 0;
+    for (; i + 32 <= n; i += 32) {
+        c0 = _mm256_sub_epi32(c0, _mm256_cmpeq_epi32(k, _mm256_loadu_si256((const __m256i*)(arr + i))));
+        c1 = _mm256_sub_epi32(c1, _mm256_cmpeq_epi32(k, _mm256_loadu_si256((const __m256i*)(arr + i + 8))));
+        c2 = _mm256_sub_epi32(c2, _mm256_cmpeq_epi32(k, _mm256_loadu_si256((const __m256i*)(arr + i + 16))));
+        c3 = _mm256_sub_epi32(c3, _mm256_cmpeq_epi32(k, _mm256_loadu_si256((const __m256i*)(arr + i + 24))));
+    }
+    __m256i c8 = _mm256_add_epi32(_mm256_add_epi32(c0, c1), _mm256_add_epi32(c2, c3));
+    __m128i c = _mm_add_epi32(_mm256_castsi256_si128(c8), _mm256_extracti128_si256(c8, 1));
+    c = _mm_add_epi32(c, _mm_shuffle_epi32(c, 0x4E));
+    c = _mm_add_epi32(c, _mm_shuffle_epi32(c, 0xB1));
+    return _mm_cvtsi128_si32(c) + countScalar(arr + i, n - i, key);
+}
+
+__attribute__((target("avx2,popcnt")))
+static int bitmapAvx2(const int arr[], int n, int key, uint32_t bits[]) {
+    __m256i k = _mm256_set1_epi32(key);
+    int count = 0, i = 0;
+    for (; i + 32 <= n; i += 32) {
+        uint32_t word = 0;
+        for (int j = 0; j < 4; j++) {
+            __m256i e = _mm256_cmpeq_epi32(k, _mm256_loadu_si256((const __m256i*)(arr + i + 8 * j)));
+            word |= (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(e)) << (8 * j);
+        }
+        bits[i / 32] = word;
+        count += __builtin_popcount(word);
+    }
+    return count + (i < n ? bitmapScalar(arr + i, n - i, key, bits + i / 32) : 0);
+}
+
+static const struct ScanKernels sse4Kernels = {
+    "sse4.1", findSse4, findAnySse4, countSse4, bitmapSse4
+};
+
+static const struct ScanKernels avx2Kernels = {
+    "avx2", findAvx2, findAnyAvx2, countAvx2, bitmapAvx2
+};
+
+#endif
+
+static const struct ScanKernels* kernels = &scalarKernels;
+
+// Picks the widest kernels the CPU supports
+void initSimdSearch() {
+#ifdef HAVE_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        kernels = &avx2Kernels;
+    } else if (__builtin_cpu_supports("sse4.1")) {
+        kernels = &sse4Kernels;
+    }
+#endif
+}
+
+// ---------- public API ----------
+
+// Same contract as linearSearch: first index of key, or -1
+int simdLinearSearch(const int arr[], int n, int key) {
+    return kernels->find(arr, n, key);
+}
+
+// First index holding any of the needles, or -1. Up to MAX_NEEDLES take
+// a single pass over arr; more are done MAX_NEEDLES at a time, each later
+// pass only scanning up to the best match found so far.
+int simdSearchAny(const int arr[], int n, const int needles[], int numNeedles) {
+    int best = -1;
+    for (int first = 0; first < numNeedles; first += MAX_NEEDLES) {
+        int group = numNeedles - first < MAX_NEEDLES ? numNeedles - first : MAX_NEEDLES;
+        int limit = best < 0 ? n : best;
+        int found = kernels->findAny(arr, limit, needles + first, group);
+        if (found >= 0) best = found;
+    }
+    return best;
+}
+
+int simdCount(const int arr[], int n, int key) {
+    return kernels->count(arr, n, key);
+}
+
+// bits needs (n + 31) / 32 words; returns the number of matches
+int simdMatchBitmap(const int arr[], int n, int key, uint32_t bits[]) {
+    return kernels->bitmap(arr, n, key, bits);
+}
+
+// Writes the index of every match to out (room for n in the worst case)
+// and returns how many there are. Works a CHUNK at a time through a small
+// bitmap that stays in L1, then turns each set bit into an index.
+int simdMatchIndices(const int arr[], int n, int key, int out[]) {
+    uint32_t bits[CHUNK / 32];
+    int count = 0;
+    for (int base = 0; base < n; base += CHUNK) {
+        int len = n - base < CHUNK ? n - base : CHUNK;
+        if (kernels->bitmap(arr + base, len, key, bits) == 0) continue;
+        for (int w = 0; w * 32 < len; w++) {
+            uint32_t word = bits[w];
+            while (word) {
+                out[count++] = base + w * 32 + __builtin_ctz(word);
+                word &= word - 1;
+            }
+        }
+    }
+    return count;
+}
+
+// ---------- benchmark ----------
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t nextRandom(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+// Every kernel set agrees with the scalar one on random arrays with few
+// distinct values (many matches) at every length up to 300
+static int verify(const struct ScanKernels* k, uint32_t* state) {
+    int arr[300];
+    uint32_t bitsA[10], bitsB[10];
+    for (int trial = 0; trial < 20000; trial++) {
+        int n = nextRandom(state) % 300;
+        int range = 1 + nextRandom(state) % 64;
+        for (int i = 0; i < n; i++) arr[i] = (int)(nextRandom(state) % range);
+        int key = (int)(nextRandom(state) % range);
+        int needles[MAX_NEEDLES];
+        int numNeedles = 1 + nextRandom(state) % MAX_NEEDLES;
+        for (int j = 0; j < numNeedles; j++) needles[j] = (int)(nextRandom(state) % (4 * range));
+
+        if (k->find(arr, n, key) != findScalar(arr, n, key)) return 0;
+        if (k->findAny(arr, n, needles, numNeedles) != findAnyScalar(arr, n, needles, numNeedles)) return 0;
+        if (k->count(arr, n, key) != countScalar(arr, n, key)) return 0;
+        if (k->bitmap(arr, n, key, bitsA) != bitmapScalar(arr, n, key, bitsB)) return 0;
+        if (memcmp(bitsA, bitsB, (n + 31) / 32 * sizeof(uint32_t)) != 0) return 0;
+    }
+    return 1;
+}
+
+// More needles than one pass takes: the answer is still the first match
+static int verifyManyNeedles(uint32_t* state) {
+    int arr[300], needles[3 * MAX_NEEDLES + 1];
+    for (int trial = 0; trial < 20000; trial++) {
+        int n = nextRandom(state) % 300;
+        for (int i = 0; i < n; i++) arr[i] = (int)(nextRandom(state) % 1000);
+        int numNeedles = nextRandom(state) % (3 * MAX_NEEDLES + 2);
+        for (int j = 0; j < numNeedles; j++) needles[j] = (int)(nextRandom(state) % 1000);
+        if (simdSearchAny(arr, n, needles, numNeedles) != findAnyScalar(arr, n, needles, numNeedles)) return 0;
+    }
+    return 1;
+}
+
+int main(int argc, char* argv[]) {
+    int arr[] = {10, 23, 45, 70, 11, 15};
+    int n = sizeof(arr) / sizeof(arr[0]);
+    int key = 70;
+
+    initSimdSearch();
+    int result = simdLinearSearch(arr, n, key);
+    if (result != -1) {
+        printf("Element found at index %d\n", result);
+    } else {
+        printf("Element not found\n");
+    }
+    int needles[] = {99, 11, 45};
+    printf("First of {99, 11, 45} at index %d\n", simdSearchAny(arr, n, needles, 3));
+
+    const struct ScanKernels* all[3] = {&scalarKernels, NULL, NULL};
+    int numKernels = 1;
+#ifdef HAVE_X86
+    if (__builtin_cpu_supports("sse4.1")) all[numKernels++] = &sse4Kernels;
+    if (__builtin_cpu_supports("avx2")) all[numKernels++] = &avx2Kernels;
+#endif
+    uint32_t state = 4242;
+    printf("\nUsing %s kernels\n", kernels->name);
+    for (int k = 0; k < numKernels; k++) {
+        printf("verify %-8s %s\n", all[k]->name, verify(all[k], &state) ? "ok" : "MISMATCH");
+    }
+    printf("verify %d+ needles %s\n", MAX_NEEDLES + 1, verifyManyNeedles(&state) ? "ok" : "MISMATCH");
+
+    // Sizes 16 to 1M ints (argv[1] caps them); the key is at a random
+    // position or absent, so a find scans half the array on average
+    int maxSize = argc > 1 ? atoi(argv[1]) : 1 << 20;
+    int* data = (int*)malloc((size_t)maxSize * sizeof(int));
+    int* out = (int*)malloc((size_t)maxSize * sizeof(int));
+    uint32_t* bits = (uint32_t*)malloc(((size_t)maxSize / 32 + 1) * sizeof(uint32_t));
+    for (int i = 0; i < maxSize; i++) data[i] = (int)(nextRandom(&state) % 1000000);
+    long checksum = 0;
+
+    printf("\nns per call (find: key at a random spot or absent; others: full scan)\n");
+    printf("%9s %-8s %10s %10s %10s %10s %10s\n", "n", "kernels", "find", "4 needles", "count", "bitmap", "indices");
+    for (int size = 16; size <= maxSize; size *= 4) {
+        int calls = (int)(50000000L / size) + 1;
+        int keys[64];
+        for (int q = 0; q < 64; q++) {
+            int pos = (int)(nextRandom(&state) % (uint32_t)(2 * size));
+            keys[q] = pos < size ? data[pos] : -1;
+        }
+
+        double start = nowSeconds();
+        for (int c = 0; c < calls; c++) checksum += linearSearch(data, size, keys[c & 63]);
+        printf("%9d %-8s %10.1f\n", size, "original", (nowSeconds() - start) * 1e9 / calls);
+
+        for (int k = 0; k < numKernels; k++) {
+            const struct ScanKernels* kn = all[k];
+            double ns[5];
+            for (int op = 0; op < 5; op++) {
+                start = nowSeconds();
+                for (int c = 0; c < calls; c++) {
+                    int key = keys[c & 63];
+                    switch (op) {
+                        case 0: checksum += kn->find(data, size, key); break;
+                        case 1: checksum += kn->findAny(data, size, keys + (c & 60), 4); break;
+                        case 2: checksum += kn->count(data, size, key); break;
+                        case 3: checksum += kn->bitmap(data, size, key, bits); break;
+                        default: {
+                            const struct ScanKernels* saved = kernels;
+                            kernels = kn;
+                            checksum += simdMatchIndices(data, size, key, out);
+                            kernels = saved;
+                        }
+                    }
+                }
+                ns[op] = (nowSeconds() - start) * 1e9 / calls;
+            }
+            printf("%9s %-8s %10.1f %10.1f %10.1f %10.1f %10.1f\n", "", kn->name, ns[0], ns[1], ns[2], ns[3], ns[4]);
+        }
+    }
+    printf("(checksum %ld)\n", checksum);
+
+    free(data);
+    free(out);
+    free(bits);
+    return 0;
+}
@@ -0,0 +1,325 @@
+// Argsort and key-index sorting for large records
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#define RADIX_BITS 8
+#define RADIX (1 << RADIX_BITS)
+#define INSERTION_CUTOFF 16
+
+// A record's sort key is the int at keyOffset. Instead of moving records,
+// each one becomes a 64-bit word: the key (sign bit flipped, so signed
+// order becomes unsigned order) in the high half, its index in the low
+// half. Words are unique and sort by key, then index, so every path below
+// is stable, and the sorted words' low halves are the permutation.
+
+enum SortPath { SORT_RADIX, SORT_QUICK, SORT_MERGE };
+
+static uint64_t packKey(int key, uint32_t index) {
+    return ((uint64_t)((uint32_t)key ^ 0x80000000u) << 32) | index;
+}
+
+// ---------- radix path ----------
+
+// The words start in index order and LSD radix sort is stable, so only
+// the four key bytes need a pass
+static void radixSortPacked(uint64_t arr[], int n) {
+    size_t histogram[4][RADIX];
+    uint64_t* src = arr;
+    uint64_t* dst = (uint64_t*)malloc((size_t)n * sizeof(uint64_t));
+    uint64_t* scratch = dst;
+
+    memset(histogram, 0, sizeof(histogram));
+    for (int i = 0; i < n; i++) {
+        for (int p = 0; p < 4; p++) histogram[p][(src[i] >> (32 + p * RADIX_BITS)) & (RADIX - 1)]++;
+    }
+
+    for (int p = 0; p < 4; p++) {
+        int shift = 32 + p * RADIX_BITS;
+        if (n == 0 || histogram[p][(src[0] >> shift) & (RADIX - 1)] == (size_t)n) continue;
+
+        size_t offset[RADIX], sum = 0;
+        for (int d = 0; d < RADIX; d++) {
+            offset[d] = sum;
+            sum += histogram[p][d];
+        }
+        for (int i = 0; i < n; i++) {
+            dst[offset[(src[i] >> shift) & (RADIX - 1)]++] = src[i];
+        }
+
+        uint64_t* temp = src;
+        src = dst;
+        dst = temp;
+    }
+
+    if (src != arr) memcpy(arr, src, (size_t)n * sizeof(uint64_t));
+    free(scratch);
+}
+
+// ---------- quick path ----------
+
+static void swapWords(uint64_t* a, uint64_t* b) {
+    uint64_t temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+// partition() from quick_sort.c on 64-bit words
+static int partitionWords(uint64_t arr[], int low, int high) {
+    uint64_t pivot = arr[high];
+    int i = low - 1;
+
+    for (int j = low; j < high; j++) {
+        if (arr[j] < pivot) {
+            i++;
+            swapWords(&arr[i], &arr[j]);
+        }
+    }
+    swapWords(&arr[i + 1], &arr[high]);
+    return i + 1;
+}
+
+static void insertionSortWords(uint64_t arr[], int low, int high) {
+    for (int i = low + 1; i <= high; i++) {
+        uint64_t key = arr[i];
+        int j = i - 1;
+        while (j >= low && arr[j] > key) {
+            arr[j + 1] = arr[j];
+            j--;
+        }
+        arr[j + 1] = key;
+    }
+}
+
+// Records often arrive sorted by key, which makes the packed words sorted
+// too, so the median of three goes to arr[high] before partitioning and
+// only the smaller side recurses
+static void quickSortPacked(uint64_t arr[], int low, int high) {
+    while (high - low + 1 > INSERTION_CUTOFF) {
+        int mid = low + (high - low) / 2;
+        if (arr[mid] < arr[low]) swapWords(&arr[mid], &arr[low]);
+        if (arr[high] < arr[low]) swapWords(&arr[high], &arr[low]);
+        if (arr[mid] < arr[high]) swapWords(&arr[mid], &arr[high]);
+
+        int pi = partitionWords(arr, low, high);
+        if (pi - low < high - pi) {
+            quickSortPacked(arr, low, pi - 1);
+            low = pi + 1;
+        } else {
+            quickSortPacked(arr, pi + 1, high);
+            high = pi - 1;
+        }
+    }
+    insertionSortWords(arr, low, high);
+}
+
+// ---------- merge path ----------
+
+// merge() from merge_sort.c on 64-bit words, with one scratch buffer
+static void mergeWords(uint64_t arr[], uint64_t tmp[], int left, int mid, int right) {
+    int n1 = mid - left + 1;
+    memcpy(tmp + left, arr + left, (size_t)(right - left + 1) * sizeof(uint64_t));
+
+    int i = left, j = mid + 1, k = left;
+    while (i < left + n1 && j <= right) {
+        if (tmp[i] <= tmp[j]) arr[k++] = tmp[i++];
+        else arr[k++] = tmp[j++];
+    }
+    while (i < left + n1) arr[k++] = tmp[i++];
+    while (j <= right) arr[k++] = tmp[j++];
+}
+
+static void mergeSortWords(uint64_t arr[], uint64_t tmp[], int left, int right) {
+    if (right - left + 1 <= INSERTION_CUTOFF) {
+        insertionSortWords(arr, left, right);
+        return;
+    }
+    int mid = left + (right - left) / 2;
+    mergeSortWords(arr, tmp, left, mid);
+    mergeSortWords(arr, tmp, mid + 1, right);
+    if (arr[mid] <= arr[mid + 1]) return;   // Already in order
+    mergeWords(arr, tmp, left, mid, right);
+}
+
+static void mergeSortPacked(uint64_t arr[], int n) {
+    uint64_t* tmp = (uint64_t*)malloc((size_t)n * sizeof(uint64_t));
+    mergeSortWords(arr, tmp, 0, n - 1);
+    free(tmp);
+}
+
+// ---------- argsort ----------
+
+static int keyAt(const void* records, int i, size_t recordSize, size_t keyOffset) {
+    int key;
+    memcpy(&key, (const char*)records + (size_t)i * recordSize + keyOffset, sizeof(int));
+    return key;
+}
+
+// Fills perm so records[perm[0]], records[perm[1]], ... is sorted by key,
+// equal keys keeping their original order. The records do not move.
+void argsort(const void* records, int n, size_t recordSize, size_t keyOffset,
+             enum SortPath path, uint32_t perm[]) {
+    uint64_t* words = (uint64_t*)malloc((size_t)n * sizeof(uint64_t));
+    for (int i = 0; i < n; i++) words[i] = packKey(keyAt(records, i, recordSize, keyOffset), (uint32_t)i);
+
+    if (path == SORT_RADIX) radixSortPacked(words, n);
+    else if (path == SORT_QUICK) quickSortPacked(words, 0, n - 1);
+    else mergeSortPacked(words, n);
+
+    for (int i = 0; i < n; i++) perm[i] = (uint32_t)words[i];
+    free(words);
+}
+
+// Rearranges records so position i holds what was at perm[i], in place.
+// Each cycle of the permutation is walked once with a single record of
+// scratch, so every record moves exactly once plus one per cycle.
+void applyPermutation(void* records, int n, size_t recordSize, const uint32_t perm[]) {
+    unsigned char* done = (unsigned char*)calloc((size_t)n / 8 + 1, 1);
+    char* base = (char*)records;
+    char* hold = (char*)malloc(recordSize);
+
+    for (int start = 0; start < n; start++) {
+        if ((done[start >> 3] >> (start & 7)) & 1) continue;
+        if (perm[start] == (uint32_t)start) continue;
+
+        memcpy(hold, base + (size_t)start * recordSize, recordSize);
+        int j = start;
+        for (;;) {
+            done[j >> 3] |= (unsigned char)(1 << (j & 7));
+            int from = (int)perm[j];
+            if (from == start) break;
+            memcpy(base + (size_t)j * recordSize, base + (size_t)from * recordSize, recordSize);
+            j = from;
+        }
+        memcpy(base + (size_t)j * recordSize, hold, recordSize);
+    }
+    free(hold);
+    free(done);
+}
+
+// Key-index sort: argsort, then one in-place pass over the records
+void sortRecords(void* records, int n, size_t recordSize, size_t keyOffset, enum SortPath path) {
+    uint32_t* perm = (uint32_t*)malloc((size_t)n * sizeof(uint32_t));
+    argsort(records, n, recordSize, keyOffset, path, perm);
+    applyPermutation(records, n, recordSize, perm);
+    free(perm);
+}
+
+void display(int arr[], int n) {
+    for (int i = 0; i < n; i++) {
+        printf("%d ", arr[i]);
+    }
+    printf("\n");
+}
+
+// ---------- benchmark ----------
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Sorting the records themselves: qsort swaps whole records
+static int compareRecords(const void* a, const void* b) {
+    int x, y;
+    memcpy(&x, a, sizeof(int));
+    memcpy(&y, b, sizeof(int));
+    return (x > y) - (x < y);
+}
+
+// Test records: key at offset 0, original position at offset 4, filler after
+static void fillRecords(char* records, int n, size_t recordSize, int keyRange) {
+    unsigned int state = 12345;
+    for (int i = 0; i < n; i++) {
+        char* r = records + (size_t)i * recordSize;
+        state = state * 1103515245u + 12345u;
+        int key = (int)(state >> 1) % keyRange - keyRange / 2;
+        memcpy(r, &key, sizeof(int));
+        memcpy(r + 4, &i, sizeof(int));
+        memset(r + 8, i & 0xFF, recordSize - 8);
+    }
+}
+
+// Sorted by key, and records with equal keys keep their original order
+static int isStableSorted(const char* records, int n, size_t recordSize, int checkStable) {
+    for (int i = 1; i < n; i++) {
+        int k0, k1, p0, p1;
+        memcpy(&k0, records + (size_t)(i - 1) * recordSize, sizeof(int));
+        memcpy(&k1, records + (size_t)i * recordSize, sizeof(int));
+        memcpy(&p0, records + (size_t)(i - 1) * recordSize + 4, sizeof(int));
+        memcpy(&p1, records + (size_t)i * recordSize + 4, sizeof(int));
+        if (k0 > k1 || (checkStable && k0 == k1 && p0 > p1)) return 0;
+        if ((unsigned char)records[(size_t)i * recordSize + recordSize - 1] != (p1 & 0xFF)) return 0;
+    }
+    return 1;
+}
+
+int main(int argc, char* argv[]) {
+    int keys[] = {42, -7, 19, 42, 0, -7, 3};
+    int n = sizeof(keys) / sizeof(keys[0]);
+    uint32_t perm[7];
+
+    printf("Keys: ");
+    display(keys, n);
+
+    argsort(keys, n, sizeof(int), 0, SORT_RADIX, perm);
+    printf("Argsort: ");
+    for (int i = 0; i < n; i++) printf("%u ", perm[i]);
+    printf("\n");
+
+    sortRecords(keys, n, sizeof(int), 0, SORT_MERGE);
+    printf("Sorted keys: ");
+    display(keys, n);
+
+    int count = argc > 1 ? atoi(argv[1]) : 1000000;
+    const size_t recordSizes[] = {16, 64, 128, 256};
+    char* records = (char*)malloc((size_t)count * 256);
+    uint32_t* order = (uint32_t*)malloc((size_t)count * sizeof(uint32_t));
+
+    printf("\n%d records, random int keys (ms)\n", count);
+    printf("%7s %10s %10s %10s %10s %12s\n", "bytes", "qsort", "radix", "quick", "merge", "argsort only");
+    for (int s = 0; s < 4; s++) {
+        size_t size = recordSizes[s];
+        double ms[5];
+        int ok = 1;
+
+        fillRecords(records, count, size, 1 << 30);
+        double start = nowSeconds();
+        qsort(records, count, size, compareRecords);
+        ms[0] = (nowSeconds() - start) * 1e3;
+        ok &= isStableSorted(records, count, size, 0);
+
+        for (int p = 0; p < 3; p++) {
+            fillRecords(records, count, size, 1 << 30);
+            start = nowSeconds();
+            sortRecords(records, count, size, 0, (enum SortPath)p);
+            ms[p + 1] = (nowSeconds() - start) * 1e3;
+            ok &= isStableSorted(records, count, size, 1);
+        }
+
+        fillRecords(records, count, size, 1 << 30);
+        start = nowSeconds();
+        argsort(records, count, size, 0, SORT_RADIX, order);
+        ms[4] = (nowSeconds() - start) * 1e3;
+
+        printf("%7zu %10.1f %10.1f %10.1f %10.1f %12.1f%s\n",
+               size, ms[0], ms[1], ms[2], ms[3], ms[4], ok ? "" : "  WRONG ORDER");
+    }
+
+    // Few distinct keys: every path must keep equal keys in input order
+    int stable = 1;
+    for (int p = 0; p < 3; p++) {
+        fillRecords(records, count, 64, 10);
+        sortRecords(records, count, 64, 0, (enum SortPath)p);
+        stable &= isStableSorted(records, count, 64, 1);
+    }
+    printf("\nStable on 10 distinct keys, all paths: %s\n", stable ? "yes" : "NO");
+
+    free(records);
+    free(order);
+    return 0;
+}
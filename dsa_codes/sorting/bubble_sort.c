@@ -1,14 +1,21 @@
 // Bubble Sort
 #include <stdio.h>
 
+// sort_benchmark.c defines SORT_LIBRARY and counting versions of these
+#ifndef SORT_LIBRARY
+#define LESS(a, b) ((a) < (b))
+#define COUNT_SWAP() ((void)0)
+#endif
+
 void bubbleSort(int arr[], int n) {
     for (int i = 0; i < n - 1; i++) {
         int swapped = 0;
         for (int j = 0; j < n - i - 1; j++) {
-            if (arr[j] > arr[j + 1]) {
+            if (LESS(arr[j + 1], arr[j])) {
                 int temp = arr[j];
                 arr[j] = arr[j + 1];
                 arr[j + 1] = temp;
+                COUNT_SWAP();
                 swapped = 1;
             }
         }
@@ -16,6 +23,7 @@ void bubbleSort(int arr[], int n) {
     }
 }
 
+#ifndef SORT_LIBRARY
 void display(int arr[], int n) {
     for (int i = 0; i < n; i++) {
         printf("%d ", arr[i]);
@@ -37,3 +45,4 @@ int main() {
     
     return 0;
 }
+#endif
@@ -0,0 +1,435 @@
+// External Merge Sort for binary int files larger than RAM
+// Build: gcc -O2 external_merge_sort.c -lrt
+// Usage: ./a.out input.bin output.bin budgetMB   (no arguments runs a self-test)
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+#include <errno.h>
+#include <aio.h>
+#include <unistd.h>
+#include <time.h>
+
+#define MIN_BUFFER_INTS (64 * 1024)   // Smallest merge buffer worth an I/O (256 KB)
+
+// ---------- in-memory run sort (LSD radix, see radix_sort.c) ----------
+
+static void radixSort(int arr[], int n, uint32_t* scratch) {
+    uint32_t* src = (uint32_t*)arr;
+    uint32_t* dst = scratch;
+    size_t histogram[4][256];
+
+    memset(histogram, 0, sizeof(histogram));
+    for (int i = 0; i < n; i++) {
+        uint32_t x = src[i] ^ 0x80000000u;
+        for (int p = 0; p < 4; p++) histogram[p][(x >> (8 * p)) & 255]++;
+    }
+
+    for (int p = 0; p < 4; p++) {
+        if (n == 0 || histogram[p][((src[0] ^ 0x80000000u) >> (8 * p)) & 255] == (size_t)n) continue;
+        size_t offset[256], sum = 0;
+        for (int d = 0; d < 256; d++) {
+            offset[d] = sum;
+            sum += histogram[p][d];
+        }
+        for (int i = 0; i < n; i++) {
+            dst[offset[((src[i] ^ 0x80000000u) >> (8 * p)) & 255]++] = src[i];
+        }
+        uint32_t* temp = src;
+        src = dst;
+        dst = temp;
+    }
+    if (src != (uint32_t*)arr) memcpy(arr, src, (size_t)n * sizeof(int));
+}
+
+// ---------- double-buffered asynchronous I/O ----------
+
+// While the caller consumes one buffer, an aio_read fills the other
+struct RunReader {
+    int fd;
+    off_t offset;
+    int* buf[2];
+    size_t count[2];
+    size_t capacity;   // ints per buffer
+    int current;
+    size_t pos;
+    struct aiocb cb;
+    int pending;
+};
+
+static void startRead(struct RunReader* r, int which) {
+    memset(&r->cb, 0, sizeof(r->cb));
+    r->cb.aio_fildes = r->fd;
+    r->cb.aio_buf = r->buf[which];
+    r->cb.aio_nbytes = r->capacity * sizeof(int);
+    r->cb.aio_offset = r->offset;
+    r->pending = aio_read(&r->cb) == 0;
+}
+
+static size_t finishRead(struct RunReader* r) {
+    if (!r->pending) return 0;
+    const struct aiocb* list[1] = { &r->cb };
+    while (aio_error(&r->cb) == EINPROGRESS) aio_suspend(list, 1, NULL);
+    ssize_t bytes = aio_return(&r->cb);
+    r->pending = 0;
+    if (bytes <= 0) return 0;
+    r->offset += bytes;
+    return (size_t)bytes / sizeof(int);
+}
+
+static void openReader(struct RunReader* r, int fd, size_t capacity) {
+    r->fd = fd;
+    r->offset = 0;
+    r->capacity = capacity;
+    r->buf[0] = (int*)malloc(capacity * sizeof(int));
+    r->buf[1] = (int*)malloc(capacity * sizeof(int));
+    r->current = 0;
+    r->pos = 0;
+    startRead(r, 0);
+    r->count[0] = finishRead(r);
+    r->count[1] = 0;
+    if (r->count[0] == capacity) startRead(r, 1);
+}
+
+// Returns 0 once the run is exhausted
+static int readNext(struct RunReader* r, int* value) {
+    if (r->pos == r->count[r->current]) {
+        if (r->count[r->current] < r->capacity) return 0;   // Last buffer was short: EOF
+        int other = r->current ^ 1;
+        r->count[other] = finishRead(r);
+        if (r->count[other] == 0) return 0;
+        r->current = other;
+        r->pos = 0;
+        if (r->count[other] == r->capacity) startRead(r, other ^ 1);
+    }
+    *value = r->buf[r->current][r->pos++];
+    return 1;
+}
+
+static void closeReader(struct RunReader* r) {
+    finishRead(r);
+    free(r->buf[0]);
+    free(r->buf[1]);
+}
+
+// Fills one buffer while the other is being written by aio_write
+struct RunWriter {
+    int fd;
+    off_t offset;
+    int* buf[2];
+    size_t capacity;
+    size_t count;
+    int current;
+    struct aiocb cb;
+    int pending;
+    int failed;
+};
+
+static void waitWrite(struct RunWriter* w) {
+    if (!w->pending) return;
+    const struct aiocb* list[1] = { &w->cb };
+    while (aio_error(&w->cb) == EINPROGRESS) aio_suspend(list, 1, NULL);
+    ssize_t bytes = aio_return(&w->cb);
+    w->pending = 0;
+    if (bytes != (ssize_t)w->cb.aio_nbytes) w->failed = 1;
+}
+
+static void flushBuffer(struct RunWriter* w) {
+    waitWrite(w);
+    if (w->count == 0) return;
+    memset(&w->cb, 0, sizeof(w->cb));
+    w->cb.aio_fildes = w->fd;
+    w->cb.aio_buf = w->buf[w->current];
+    w->cb.aio_nbytes = w->count * sizeof(int);
+    w->cb.aio_offset = w->offset;
+    if (aio_write(&w->cb) == 0) w->pending = 1;
+    else w->failed = 1;
+    w->offset += w->count * sizeof(int);
+    w->current ^= 1;
+    w->count = 0;
+}
+
+static void openWriter(struct RunWriter* w, int fd, size_t capacity) {
+    w->fd = fd;
+    w->offset = 0;
+    w->capacity = capacity;
+    w->buf[0] = (int*)malloc(capacity * sizeof(int));
+    w->buf[1] = (int*)malloc(capacity * sizeof(int));
+    w->count = 0;
+    w->current = 0;
+    w->pending = 0;
+    w->failed = 0;
+}
+
+static void writeNext(struct RunWriter* w, int value) {
+    w->buf[w->current][w->count++] = value;
+    if (w->count == w->capacity) flushBuffer(w);
+}
+
+// Returns 0 on success, -1 if any write failed
+static int closeWriter(struct RunWriter* w) {
+    flushBuffer(w);
+    waitWrite(w);
+    free(w->buf[0]);
+    free(w->buf[1]);
+    return w->failed ? -1 : 0;
+}
+
+// ---------- loser tree k-way merge ----------
+
+// tree[0] holds the index of the overall winner (smallest head); every
+// internal node holds the loser of the match played there. Replacing the
+// winner's key only replays the matches on its path to the root.
+struct LoserTree {
+    int k;
+    int* tree;
+    int64_t* keys;   // Current head of each run; INT64_MAX once exhausted
+};
+
+// Leaves are the implicit nodes k..2k-1; a beats b if its head is
+// smaller, with ties going to the lower run index.
+static int beats(const struct LoserTree* lt, int a, int b) {
+    return lt->keys[a] < lt->keys[b] || (lt->keys[a] == lt->keys[b] && a < b);
+}
+
+static void replay(struct LoserTree* lt, int leaf) {
+    int winner = leaf;
+    for (int node = (leaf + lt->k) / 2; node > 0; node /= 2) {
+        if (beats(lt, lt->tree[node], winner)) {
+            int loser = winner;
+            winner = lt->tree[node];
+            lt->tree[node] = loser;
+        }
+    }
+    lt->tree[0] = winner;
+}
+
+static void buildLoserTree(struct LoserTree* lt, int k, int64_t keys[]) {
+    int* winners = (int*)malloc(2 * k * sizeof(int));
+    lt->k = k;
+    lt->keys = keys;
+    lt->tree = (int*)malloc(2 * k * sizeof(int));
+
+    for (int i = 0; i < k; i++) winners[k + i] = i;
+    for (int node = k - 1; node > 0; node--) {
+        int a = winners[2 * node], b = winners[2 * node + 1];
+        winners[node] = beats(lt, a, b) ? a : b;
+        lt->tree[node] = beats(lt, a, b) ? b : a;
+    }
+    lt->tree[0] = winners[1];
+    free(winners);
+}
+
+struct PhaseStats {
+    double seconds;
+    double bytes;
+};
+
+#define MB (1024.0 * 1024.0)
+
+static double throughput(const struct PhaseStats* stats) {
+    return stats->seconds > 0 ? stats->bytes / MB / stats->seconds : 0;
+}
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Merges run files into outFd; buffers split the memory budget evenly
+static int mergeRuns(FILE* runs[], int k, int outFd, size_t budgetInts, struct PhaseStats* stats) {
+    size_t bufferInts = budgetInts / (2 * (size_t)(k + 1));
+    if (bufferInts < MIN_BUFFER_INTS) return -1;
+    struct RunReader* readers = (struct RunReader*)malloc(k * sizeof(struct RunReader));
+    int64_t* keys = (int64_t*)malloc(k * sizeof(int64_t));
+    struct RunWriter writer;
+    struct LoserTree lt;
+    double start = nowSeconds();
+    size_t written = 0;
+
+    for (int i = 0; i < k; i++) {
+        openReader(&readers[i], fileno(runs[i]), bufferInts);
+        int value;
+        keys[i] = readNext(&readers[i], &value) ? value : INT64_MAX;
+    }
+    openWriter(&writer, outFd, bufferInts);
+    buildLoserTree(&lt, k, keys);
+
+    while (keys[lt.tree[0]] != INT64_MAX) {
+        int winner = lt.tree[0];
+        writeNext(&writer, (int)keys[winner]);
+        written++;
+        int value;
+        keys[winner] = readNext(&readers[winner], &value) ? value : INT64_MAX;
+        replay(&lt, winner);
+    }
+
+    int result = closeWriter(&writer);
+    for (int i = 0; i < k; i++) closeReader(&readers[i]);
+    free(readers);
+    free(keys);
+    free(lt.tree);
+
+    stats->seconds += nowSeconds() - start;
+    stats->bytes += (double)written * sizeof(int);
+    return result;
+}
+
+// ---------- driver ----------
+
+// Sorts the binary int file at inputPath into outputPath using about
+// budgetBytes of memory. Returns 0 on success, -1 on I/O failure or a
+// budget too small for a two-way merge (MIN_BUFFER_INTS per buffer).
+int externalSort(const char* inputPath, const char* outputPath, size_t budgetBytes) {
+    size_t budgetInts = budgetBytes / sizeof(int);
+    if (budgetInts < 2 * 3 * (size_t)MIN_BUFFER_INTS) return -1;
+    FILE* input = fopen(inputPath, "rb");
+    if (input == NULL) return -1;
+
+    // Half the budget holds the run, half is the radix sort scratch. A run
+    // is capped at INT_MAX ints (8 GB), the most radixSort takes; larger
+    // budgets still go to the merge buffers.
+    size_t runInts = budgetInts / 2;
+    if (runInts > INT_MAX) runInts = INT_MAX;
+    int* run = (int*)malloc(runInts * sizeof(int));
+    uint32_t* scratch = (uint32_t*)malloc(runInts * sizeof(int));
+    if (run == NULL || scratch == NULL) {
+        free(run);
+        free(scratch);
+        fclose(input);
+        return -1;
+    }
+
+    int numRuns = 0, capacity = 16;
+    FILE** runs = (FILE**)malloc(capacity * sizeof(FILE*));
+    struct PhaseStats readStats = {0, 0}, sortStats = {0, 0}, spillStats = {0, 0}, mergeStats = {0, 0};
+    int result = 0;
+
+    // Phase 1: sorted runs with large sequential reads and writes
+    for (;;) {
+        double t0 = nowSeconds();
+        size_t count = fread(run, sizeof(int), runInts, input);
+        double t1 = nowSeconds();
+        if (count == 0) break;
+        radixSort(run, (int)count, scratch);
+        double t2 = nowSeconds();
+
+        FILE* spill = tmpfile();
+        if (spill == NULL || fwrite(run, sizeof(int), count, spill) != count || fflush(spill) != 0) {
+            if (spill != NULL) fclose(spill);
+            result = -1;
+            break;
+        }
+        double t3 = nowSeconds();
+
+        if (numRuns == capacity) {
+            capacity *= 2;
+            runs = (FILE**)realloc(runs, capacity * sizeof(FILE*));
+        }
+        runs[numRuns++] = spill;
+        readStats.seconds += t1 - t0;
+        sortStats.seconds += t2 - t1;
+        spillStats.seconds += t3 - t2;
+        readStats.bytes += (double)count * sizeof(int);
+        sortStats.bytes = spillStats.bytes = readStats.bytes;
+        if (count < runInts) break;
+    }
+    fclose(input);
+    free(run);
+    free(scratch);
+
+    // Phase 2: merge passes until one run remains, never exceeding the
+    // fan-in whose buffers still fit the budget
+    int maxFanIn = (int)(budgetInts / (2 * MIN_BUFFER_INTS)) - 1;
+    if (maxFanIn < 2) maxFanIn = 2;
+    int passes = 0;
+
+    while (result == 0 && numRuns > maxFanIn) {
+        int merged = 0, first = 0;
+        for (; first < numRuns && result == 0; first += maxFanIn) {
+            int k = numRuns - first < maxFanIn ? numRuns - first : maxFanIn;
+            FILE* out = tmpfile();
+            if (out == NULL || mergeRuns(runs + first, k, fileno(out), budgetInts, &mergeStats) != 0) result = -1;
+            for (int i = 0; i < k; i++) fclose(runs[first + i]);
+            runs[merged++] = out;
+        }
+        // After a failure, the groups past it were never merged
+        for (int i = first; i < numRuns; i++) fclose(runs[i]);
+        numRuns = merged;
+        passes++;
+    }
+
+    if (result == 0) {
+        FILE* output = fopen(outputPath, "wb");
+        if (output == NULL) {
+            result = -1;
+        } else {
+            if (numRuns > 0) result = mergeRuns(runs, numRuns, fileno(output), budgetInts, &mergeStats);
+            if (fclose(output) != 0) result = -1;
+            passes++;
+        }
+    }
+    for (int i = 0; i < numRuns; i++) {
+        if (runs[i] != NULL) fclose(runs[i]);
+    }
+    free(runs);
+
+    printf("runs: %.0f MB read at %.0f MB/s, sorted at %.0f MB/s, spilled at %.0f MB/s\n",
+           readStats.bytes / MB, throughput(&readStats), throughput(&sortStats), throughput(&spillStats));
+    printf("merge: %d pass(es), %.0f MB merged at %.0f MB/s\n", passes, mergeStats.bytes / MB, throughput(&mergeStats));
+    return result;
+}
+
+// ---------- self-test ----------
+
+int main(int argc, char* argv[]) {
+    if (argc >= 4) {
+        size_t budget = (size_t)atol(argv[3]) * 1024 * 1024;
+        if (externalSort(argv[1], argv[2], budget) != 0) {
+            printf("External sort failed\n");
+            return 1;
+        }
+        return 0;
+    }
+
+    const char* inputPath = "external_input.bin";
+    const char* outputPath = "external_output.bin";
+    const int n = 20000000;       // 80 MB of ints
+    const size_t budget = 8u << 20;   // 8 MB: 20 runs, two merge passes
+
+    FILE* file = fopen(inputPath, "wb");
+    if (file == NULL) return 1;
+    unsigned int state = 12345;
+    for (int i = 0; i < n; i++) {
+        state = state * 1103515245u + 12345u;
+        int value = (int)(state ^ (state << 16));
+        fwrite(&value, sizeof(int), 1, file);
+    }
+    fclose(file);
+
+    // Budgets whose merge buffers would be empty must fail, not drop data
+    int tinyRejected = externalSort(inputPath, outputPath, 16) != 0
+                    && externalSort(inputPath, outputPath, 1u << 20) != 0;
+    printf("Tiny budgets %s\n", tinyRejected ? "rejected" : "NOT REJECTED");
+
+    printf("Sorting %d ints (%d MB) with a %zu MB budget\n", n, (int)(n * sizeof(int) >> 20), budget >> 20);
+    int result = externalSort(inputPath, outputPath, budget);
+
+    file = fopen(outputPath, "rb");
+    long count = 0;
+    int previous = INT32_MIN, value, sorted = result == 0 && file != NULL;
+    while (file != NULL && fread(&value, sizeof(int), 1, file) == 1) {
+        if (value < previous) sorted = 0;
+        previous = value;
+        count++;
+    }
+    if (file != NULL) fclose(file);
+    printf("Output %s (%ld ints)\n", sorted && count == n ? "sorted" : "NOT SORTED", count);
+
+    remove(inputPath);
+    remove(outputPath);
+    return sorted && count == n && tinyRejected ? 0 : 1;
+}
@@ -1,19 +1,28 @@
 // Insertion Sort
 #include <stdio.h>
 
+// sort_benchmark.c defines SORT_LIBRARY and counting versions of these
+#ifndef SORT_LIBRARY
+#define LESS(a, b) ((a) < (b))
+#define COUNT_MOVES(k) ((void)0)
+#endif
+
 void insertionSort(int arr[], int n) {
     for (int i = 1; i < n; i++) {
         int key = arr[i];
         int j = i - 1;
         
-        while (j >= 0 && arr[j] > key) {
+        while (j >= 0 && LESS(key, arr[j])) {
             arr[j + 1] = arr[j];
+            COUNT_MOVES(1);
             j--;
         }
         arr[j + 1] = key;
+        COUNT_MOVES(1);
     }
 }
 
+#ifndef SORT_LIBRARY
 void display(int arr[], int n) {
     for (int i = 0; i < n; i++) {
         printf("%d ", arr[i]);
@@ -35,3 +44,4 @@ int main() {
     
     return 0;
 }
+#endif
@@ -0,0 +1,224 @@
+// Introsort (production Quick Sort)
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define INSERTION_CUTOFF 16   // Ranges this small finish with insertion sort
+#define NINTHER_CUTOFF 128    // Larger ranges pick the pivot by ninther
+
+void swap(int* a, int* b) {
+    int temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+// ---------- original Quick Sort, kept for comparison ----------
+
+int partition(int arr[], int low, int high) {
+    int pivot = arr[high];
+    int i = low - 1;
+
+    for (int j = low; j < high; j++) {
+        if (arr[j] < pivot) {
+            i++;
+            swap(&arr[i], &arr[j]);
+        }
+    }
+    swap(&arr[i + 1], &arr[high]);
+    return i + 1;
+}
+
+void quickSort(int arr[], int low, int high) {
+    if (low < high) {
+        int pi = partition(arr, low, high);
+        quickSort(arr, low, pi - 1);
+        quickSort(arr, pi + 1, high);
+    }
+}
+
+// ---------- introsort building blocks ----------
+
+static void insertionSortRange(int arr[], int low, int high) {
+    for (int i = low + 1; i <= high; i++) {
+        int key = arr[i];
+        int j = i - 1;
+        while (j >= low && arr[j] > key) {
+            arr[j + 1] = arr[j];
+            j--;
+        }
+        arr[j + 1] = key;
+    }
+}
+
+static void siftDown(int arr[], int base, int root, int size) {
+    int value = arr[base + root];
+    for (;;) {
+        int child = 2 * root + 1;
+        if (child >= size) break;
+        if (child + 1 < size && arr[base + child + 1] > arr[base + child]) child++;
+        if (arr[base + child] <= value) break;
+        arr[base + root] = arr[base + child];
+        root = child;
+    }
+    arr[base + root] = value;
+}
+
+// Fallback once the depth limit is hit: O(n log n) worst case, O(1) stack
+static void heapSortRange(int arr[], int low, int high) {
+    int size = high - low + 1;
+    for (int i = size / 2 - 1; i >= 0; i--) {
+        siftDown(arr, low, i, size);
+    }
+    for (int end = size - 1; end > 0; end--) {
+        swap(&arr[low], &arr[low + end]);
+        siftDown(arr, low, 0, end);
+    }
+}
+
+static int medianOf3(int arr[], int a, int b, int c) {
+    if (arr[a] < arr[b]) {
+        if (arr[b] < arr[c]) return b;
+        return arr[a] < arr[c] ? c : a;
+    }
+    if (arr[a] < arr[c]) return a;
+    return arr[b] < arr[c] ? c : b;
+}
+
+// Median of three for small ranges, Tukey's ninther for large ones
+static int choosePivot(int arr[], int low, int high) {
+    int n = high - low + 1;
+    int mid = low + n / 2;
+
+    if (n <= NINTHER_CUTOFF) {
+        return arr[medianOf3(arr, low, mid, high)];
+    }
+
+    int step = n / 8;
+    int a = medianOf3(arr, low, low + step, low + 2 * step);
+    int b = medianOf3(arr, mid - step, mid, mid + step);
+    int c = medianOf3(arr, high - 2 * step, high - step, high);
+    return arr[medianOf3(arr, a, b, c)];
+}
+
+// Dutch national flag partition: afterwards arr[low..*lt-1] < pivot,
+// arr[*lt..*gt] == pivot and arr[*gt+1..high] > pivot
+static void partition3Way(int arr[], int low, int high, int pivot, int* lt, int* gt) {
+    int i = low;
+    *lt = low;
+    *gt = high;
+
+    while (i <= *gt) {
+        if (arr[i] < pivot) {
+            swap(&arr[i++], &arr[(*lt)++]);
+        } else if (arr[i] > pivot) {
+            swap(&arr[i], &arr[(*gt)--]);
+        } else {
+            i++;
+        }
+    }
+}
+
+static void introSortLoop(int arr[], int low, int high, int depthLimit) {
+    while (high - low + 1 > INSERTION_CUTOFF) {
+        if (depthLimit-- == 0) {
+            heapSortRange(arr, low, high);
+            return;
+        }
+
+        int lt, gt;
+        partition3Way(arr, low, high, choosePivot(arr, low, high), &lt, &gt);
+
+        // Recurse into the smaller side, loop on the larger: stack depth <= log2(n)
+        if (lt - low < high - gt) {
+            introSortLoop(arr, low, lt - 1, depthLimit);
+            low = gt + 1;
+        } else {
+            introSortLoop(arr, gt + 1, high, depthLimit);
+            high = lt - 1;
+        }
+    }
+    insertionSortRange(arr, low, high);
+}
+
+// Drop-in replacement for quickSort(arr, low, high)
+void introSort(int arr[], int low, int high) {
+    if (low >= high) return;
+
+    int depthLimit = 0;
+    for (int n = high - low + 1; n > 1; n >>= 1) depthLimit += 2;
+    introSortLoop(arr, low, high, depthLimit);
+}
+
+void display(int arr[], int n) {
+    for (int i = 0; i < n; i++) {
+        printf("%d ", arr[i]);
+    }
+    printf("\n");
+}
+
+// ---------- benchmark ----------
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void fillInput(int arr[], int n, int shape) {
+    unsigned int state = 12345;
+    for (int i = 0; i < n; i++) {
+        state = state * 1103515245u + 12345u;
+        switch (shape) {
+            case 0: arr[i] = (int)(state >> 1); break;   // random
+            case 1: arr[i] = i; break;                   // sorted
+            case 2: arr[i] = n - i; break;               // reverse
+            default: arr[i] = 7; break;                  // all equal
+        }
+    }
+}
+
+static int isSorted(const int arr[], int n) {
+    for (int i = 1; i < n; i++) {
+        if (arr[i - 1] > arr[i]) return 0;
+    }
+    return 1;
+}
+
+static void benchmark(const char* name, void (*sort)(int[], int, int), int n) {
+    const char* shapes[] = {"random", "sorted", "reverse", "equal"};
+    int* arr = (int*)malloc(n * sizeof(int));
+
+    printf("%-10s n=%-9d", name, n);
+    for (int s = 0; s < 4; s++) {
+        fillInput(arr, n, s);
+        double start = nowSeconds();
+        sort(arr, 0, n - 1);
+        double ms = (nowSeconds() - start) * 1e3;
+        printf(" %s %.1f ms%s", shapes[s], ms, isSorted(arr, n) ? "" : " (UNSORTED)");
+    }
+    printf("\n");
+    free(arr);
+}
+
+int main(int argc, char* argv[]) {
+    int arr[] = {10, 7, 8, 9, 1, 5, 7, 7, 3};
+    int n = sizeof(arr) / sizeof(arr[0]);
+
+    printf("Original array: ");
+    display(arr, n);
+
+    introSort(arr, 0, n - 1);
+
+    printf("Sorted array: ");
+    display(arr, n);
+
+    // The original quickSort is quadratic on sorted/equal input, so it
+    // only runs at a size it can finish; introSort also runs at full size.
+    printf("\n");
+    benchmark("quickSort", quickSort, 20000);
+    benchmark("introSort", introSort, 20000);
+    benchmark("introSort", introSort, argc > 1 ? atoi(argv[1]) : 10000000);
+
+    return 0;
+}
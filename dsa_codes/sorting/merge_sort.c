@@ -1,11 +1,24 @@
 // Merge Sort
 #include <stdio.h>
+#include <stdlib.h>
 
-void merge(int arr[], int left, int mid, int right) {
+// sort_benchmark.c defines SORT_LIBRARY and counting versions of these
+#ifndef SORT_LIBRARY
+#define LESS(a, b) ((a) < (b))
+#define COUNT_MOVES(k) ((void)0)
+#define ENTER() ((void)0)
+#define LEAVE() ((void)0)
+#define SCRATCH_ALLOC(bytes) malloc(bytes)
+#define SCRATCH_FREE(p, bytes) free(p)
+#endif
+
+// L and R sit in tmp at the offsets of their range. One buffer per sort
+// replaces stack VLAs, which overflow the stack past roughly 1M ints.
+void merge(int arr[], int tmp[], int left, int mid, int right) {
     int n1 = mid - left + 1;
     int n2 = right - mid;
-    
-    int L[n1], R[n2];
+    int* L = tmp + left;
+    int* R = tmp + mid + 1;
     
     for (int i = 0; i < n1; i++)
         L[i] = arr[left + i];
@@ -15,7 +28,7 @@ void merge(int arr[], int left, int mid, int right) {
     int i = 0, j = 0, k = left;
     
     while (i < n1 && j < n2) {
-        if (L[i] <= R[j]) {
+        if (!LESS(R[j], L[i])) {
             arr[k++] = L[i++];
         } else {
             arr[k++] = R[j++];
@@ -24,17 +37,29 @@ void merge(int arr[], int left, int mid, int right) {
     
     while (i < n1) arr[k++] = L[i++];
     while (j < n2) arr[k++] = R[j++];
+    COUNT_MOVES(right - left + 1);
 }
 
-void mergeSort(int arr[], int left, int right) {
+static void mergeSortRange(int arr[], int tmp[], int left, int right) {
     if (left < right) {
+        ENTER();
         int mid = left + (right - left) / 2;
-        mergeSort(arr, left, mid);
-        mergeSort(arr, mid + 1, right);
-        merge(arr, left, mid, right);
+        mergeSortRange(arr, tmp, left, mid);
+        mergeSortRange(arr, tmp, mid + 1, right);
+        merge(arr, tmp, left, mid, right);
+        LEAVE();
     }
 }
 
+void mergeSort(int arr[], int left, int right) {
+    if (left >= right) return;
+    size_t bytes = (size_t)(right + 1) * sizeof(int);
+    int* tmp = (int*)SCRATCH_ALLOC(bytes);
+    mergeSortRange(arr, tmp, left, right);
+    SCRATCH_FREE(tmp, bytes);
+}
+
+#ifndef SORT_LIBRARY
 void display(int arr[], int n) {
     for (int i = 0; i < n; i++) {
         printf("%d ", arr[i]);
@@ -56,3 +81,4 @@ int main() {
     
     return 0;
 }
+#endif
@@ -0,0 +1,303 @@
+// Parallel Merge Sort (thread pool, one scratch buffer, co-rank merge)
+// Build: gcc -O2 -pthread parallel_merge_sort.c
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+
+#define INSERTION_CUTOFF 32     // Leaves are insertion sorted in place
+#define SERIAL_SORT_CUTOFF 65536 // Below this, no new tasks are spawned
+#define SERIAL_MERGE_CUTOFF 131072
+#define MAX_MERGE_CHUNKS 64
+
+// ---------- fork-join thread pool ----------
+
+enum TaskState { TASK_QUEUED, TASK_RUNNING, TASK_DONE };
+
+struct Task {
+    void (*run)(void* arg);
+    void* arg;
+    enum TaskState state;
+    struct Task* next;
+};
+
+// Tasks sit on a LIFO stack. A thread waiting in joinTask() runs other
+// queued tasks instead of blocking, so nested fork-join never deadlocks.
+struct ThreadPool {
+    pthread_t* threads;
+    int numWorkers;
+    int numThreads;   // Workers plus the calling thread
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    struct Task* stack;
+    int stop;
+};
+
+static struct Task* popTask(struct ThreadPool* pool) {
+    struct Task* task = pool->stack;
+    if (task != NULL) {
+        pool->stack = task->next;
+        task->state = TASK_RUNNING;
+    }
+    return task;
+}
+
+// Called with the lock held; returns with it held
+static void runTask(struct ThreadPool* pool, struct Task* task) {
+    pthread_mutex_unlock(&pool->lock);
+    task->run(task->arg);
+    pthread_mutex_lock(&pool->lock);
+    task->state = TASK_DONE;
+    pthread_cond_broadcast(&pool->changed);
+}
+
+static void* workerMain(void* arg) {
+    struct ThreadPool* pool = (struct ThreadPool*)arg;
+    pthread_mutex_lock(&pool->lock);
+    while (!pool->stop) {
+        struct Task* task = popTask(pool);
+        if (task != NULL) runTask(pool, task);
+        else pthread_cond_wait(&pool->changed, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+void createPool(struct ThreadPool* pool, int numThreads) {
+    pool->numThreads = numThreads < 1 ? 1 : numThreads;
+    pool->numWorkers = pool->numThreads - 1;
+    pool->threads = (pthread_t*)malloc((pool->numWorkers + 1) * sizeof(pthread_t));
+    pool->stack = NULL;
+    pool->stop = 0;
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->changed, NULL);
+    for (int i = 0; i < pool->numWorkers; i++) {
+        pthread_create(&pool->threads[i], NULL, workerMain, pool);
+    }
+}
+
+void destroyPool(struct ThreadPool* pool) {
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->changed);
+    pthread_mutex_unlock(&pool->lock);
+    for (int i = 0; i < pool->numWorkers; i++) {
+        pthread_join(pool->threads[i], NULL);
+    }
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->changed);
+    free(pool->threads);
+}
+
+void spawnTask(struct ThreadPool* pool, struct Task* task, void (*run)(void*), void* arg) {
+    task->run = run;
+    task->arg = arg;
+    pthread_mutex_lock(&pool->lock);
+    task->state = TASK_QUEUED;
+    task->next = pool->stack;
+    pool->stack = task;
+    pthread_cond_signal(&pool->changed);
+    pthread_mutex_unlock(&pool->lock);
+}
+
+void joinTask(struct ThreadPool* pool, struct Task* task) {
+    pthread_mutex_lock(&pool->lock);
+    while (task->state != TASK_DONE) {
+        struct Task* other = popTask(pool);
+        if (other != NULL) runTask(pool, other);
+        else pthread_cond_wait(&pool->changed, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+// ---------- merging ----------
+
+// Stable serial merge: on ties the element from a comes first
+static void mergeSerial(const int a[], int na, const int b[], int nb, int out[]) {
+    int i = 0, j = 0, k = 0;
+    while (i < na && j < nb) {
+        if (a[i] <= b[j]) out[k++] = a[i++];
+        else out[k++] = b[j++];
+    }
+    while (i < na) out[k++] = a[i++];
+    while (j < nb) out[k++] = b[j++];
+}
+
+// Co-rank: how many of the first k merged outputs come from a. Found by
+// binary search for the smallest i whose a[i] no longer precedes b[k-i-1].
+static int coRank(int k, const int a[], int na, const int b[], int nb) {
+    int lo = k > nb ? k - nb : 0;
+    int hi = k < na ? k : na;
+    while (lo < hi) {
+        int i = lo + (hi - lo) / 2;
+        if (a[i] <= b[k - i - 1]) lo = i + 1;
+        else hi = i;
+    }
+    return lo;
+}
+
+struct MergeChunk {
+    const int* a;
+    int na;
+    const int* b;
+    int nb;
+    int* out;
+    int begin;   // Output range [begin, end)
+    int end;
+};
+
+static void mergeChunk(void* arg) {
+    struct MergeChunk* c = (struct MergeChunk*)arg;
+    int i0 = coRank(c->begin, c->a, c->na, c->b, c->nb);
+    int i1 = coRank(c->end, c->a, c->na, c->b, c->nb);
+    int j0 = c->begin - i0, j1 = c->end - i1;
+    mergeSerial(c->a + i0, i1 - i0, c->b + j0, j1 - j0, c->out + c->begin);
+}
+
+// Splits the output into equal chunks, each merged independently
+static void mergeParallel(struct ThreadPool* pool, const int a[], int na, const int b[], int nb, int out[]) {
+    int total = na + nb;
+    int chunks = pool->numThreads * 2;
+    if (chunks > MAX_MERGE_CHUNKS) chunks = MAX_MERGE_CHUNKS;
+    if (total < SERIAL_MERGE_CUTOFF || chunks == 2) {
+        mergeSerial(a, na, b, nb, out);
+        return;
+    }
+
+    struct MergeChunk parts[MAX_MERGE_CHUNKS];
+    struct Task tasks[MAX_MERGE_CHUNKS];
+    for (int c = 0; c < chunks; c++) {
+        parts[c] = (struct MergeChunk){ a, na, b, nb, out,
+                                        (int)((long)total * c / chunks), (int)((long)total * (c + 1) / chunks) };
+        if (c < chunks - 1) spawnTask(pool, &tasks[c], mergeChunk, &parts[c]);
+    }
+    mergeChunk(&parts[chunks - 1]);
+    for (int c = 0; c < chunks - 1; c++) joinTask(pool, &tasks[c]);
+}
+
+// ---------- sorting ----------
+
+static void insertionSort(int arr[], int n) {
+    for (int i = 1; i < n; i++) {
+        int key = arr[i];
+        int j = i - 1;
+        while (j >= 0 && arr[j] > key) {
+            arr[j + 1] = arr[j];
+            j--;
+        }
+        arr[j + 1] = key;
+    }
+}
+
+struct SortJob {
+    struct ThreadPool* pool;
+    int* src;
+    int* buf;
+    int n;
+    int intoBuf;   // Result lands in buf instead of src
+};
+
+// Ping-pong: the halves are sorted into the opposite buffer, then merged
+// back into the requested one, so each level copies the data exactly once.
+static void sortRun(void* arg) {
+    struct SortJob* job = (struct SortJob*)arg;
+    int n = job->n;
+
+    if (n <= INSERTION_CUTOFF) {
+        insertionSort(job->src, n);
+        if (job->intoBuf) memcpy(job->buf, job->src, n * sizeof(int));
+        return;
+    }
+
+    int half = n / 2;
+    struct SortJob left = { job->pool, job->src, job->buf, half, !job->intoBuf };
+    struct SortJob right = { job->pool, job->src + half, job->buf + half, n - half, !job->intoBuf };
+
+    if (n >= SERIAL_SORT_CUTOFF && job->pool->numThreads > 1) {
+        struct Task task;
+        spawnTask(job->pool, &task, sortRun, &left);
+        sortRun(&right);
+        joinTask(job->pool, &task);
+    } else {
+        sortRun(&left);
+        sortRun(&right);
+    }
+
+    int* from = job->intoBuf ? job->src : job->buf;
+    int* to = job->intoBuf ? job->buf : job->src;
+    if (n >= SERIAL_SORT_CUTOFF) mergeParallel(job->pool, from, half, from + half, n - half, to);
+    else mergeSerial(from, half, from + half, n - half, to);
+}
+
+// Sorts arr[0..n-1] using one scratch buffer of n ints
+void parallelMergeSort(struct ThreadPool* pool, int arr[], int n) {
+    if (n < 2) return;
+    int* scratch = (int*)malloc(n * sizeof(int));
+    struct SortJob job = { pool, arr, scratch, n, 0 };
+    sortRun(&job);
+    free(scratch);
+}
+
+void display(int arr[], int n) {
+    for (int i = 0; i < n; i++) {
+        printf("%d ", arr[i]);
+    }
+    printf("\n");
+}
+
+// ---------- speedup benchmark ----------
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char* argv[]) {
+    int arr[] = {12, 11, 13, 5, 6, 7};
+    int n = sizeof(arr) / sizeof(arr[0]);
+    struct ThreadPool pool;
+
+    printf("Original array: ");
+    display(arr, n);
+
+    createPool(&pool, 2);
+    parallelMergeSort(&pool, arr, n);
+    destroyPool(&pool);
+
+    printf("Sorted array: ");
+    display(arr, n);
+
+    // Pass 100000000 for the 100M-element run (needs ~800 MB)
+    int size = argc > 1 ? atoi(argv[1]) : 20000000;
+    int* data = (int*)malloc((size_t)size * sizeof(int));
+    int threadCounts[] = {1, 2, 4, 8, 16};
+    double baseline = 0;
+
+    printf("\n%d random ints\n%8s %10s %8s\n", size, "threads", "ms", "speedup");
+    for (int t = 0; t < 5; t++) {
+        unsigned int state = 12345;
+        for (int i = 0; i < size; i++) {
+            state = state * 1103515245u + 12345u;
+            data[i] = (int)(state >> 1);
+        }
+
+        createPool(&pool, threadCounts[t]);
+        double start = nowSeconds();
+        parallelMergeSort(&pool, data, size);
+        double ms = (nowSeconds() - start) * 1e3;
+        destroyPool(&pool);
+
+        int sorted = 1;
+        for (int i = 1; i < size; i++) {
+            if (data[i - 1] > data[i]) sorted = 0;
+        }
+        if (t == 0) baseline = ms;
+        printf("%8d %10.1f %7.2fx%s\n", threadCounts[t], ms, baseline / ms, sorted ? "" : " UNSORTED");
+    }
+
+    free(data);
+    return 0;
+}
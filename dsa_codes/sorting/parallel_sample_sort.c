@@ -0,0 +1,628 @@
+// Parallel Sample Sort (in-place block distribution, IPS4o style)
+// Build: gcc -O2 -pthread parallel_sample_sort.c
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
+#include <pthread.h>
+#include <time.h>
+
+#define LOG_SPLITTERS 7
+#define NUM_SPLITTERS (1 << LOG_SPLITTERS)   // Leaves of the splitter tree
+#define NUM_BUCKETS (2 * NUM_SPLITTERS)     // Every leaf also gets an equality bucket
+#define OVERSAMPLE 16                       // Samples drawn per splitter
+#define BLOCK 256                           // Ints moved together during distribution
+#define SEQUENTIAL_CUTOFF (1 << 16)         // Smaller inputs skip distribution
+#define MAX_THREADS 64
+#define INSERTION_CUTOFF 16                 // Bucket ranges this small finish with insertion sort
+#define NINTHER_CUTOFF 128                  // Larger ranges pick the pivot by ninther
+
+// ---------- bucket sort: the introsort from intro_sort.c ----------
+
+// Keys equal to a splitter skip this sort, but a bucket can still hold
+// long runs of other repeated keys; the 3-way partition takes each run
+// out in one pass, where quick sort's Lomuto partition goes quadratic.
+
+void swap(int* a, int* b) {
+    int temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+static void insertionSortRange(int arr[], int low, int high) {
+    for (int i = low + 1; i <= high; i++) {
+        int key = arr[i];
+        int j = i - 1;
+        while (j >= low && arr[j] > key) {
+            arr[j + 1] = arr[j];
+            j--;
+        }
+        arr[j + 1] = key;
+    }
+}
+
+static void siftDown(int arr[], int base, int root, int size) {
+    int value = arr[base + root];
+    for (;;) {
+        int child = 2 * root + 1;
+        if (child >= size) break;
+        if (child + 1 < size && arr[base + child + 1] > arr[base + child]) child++;
+        if (arr[base + child] <= value) break;
+        arr[base + root] = arr[base + child];
+        root = child;
+    }
+    arr[base + root] = value;
+}
+
+// Fallback once the depth limit is hit: O(n log n) worst case, O(1) stack
+static void heapSortRange(int arr[], int low, int high) {
+    int size = high - low + 1;
+    for (int i = size / 2 - 1; i >= 0; i--) {
+        siftDown(arr, low, i, size);
+    }
+    for (int end = size - 1; end > 0; end--) {
+        swap(&arr[low], &arr[low + end]);
+        siftDown(arr, low, 0, end);
+    }
+}
+
+static int medianOf3(int arr[], int a, int b, int c) {
+    if (arr[a] < arr[b]) {
+        if (arr[b] < arr[c]) return b;
+        return arr[a] < arr[c] ? c : a;
+    }
+    if (arr[a] < arr[c]) return a;
+    return arr[b] < arr[c] ? c : b;
+}
+
+// Median of three for small ranges, Tukey's ninther for large ones
+static int choosePivot(int arr[], int low, int high) {
+    int n = high - low + 1;
+    int mid = low + n / 2;
+
+    if (n <= NINTHER_CUTOFF) {
+        return arr[medianOf3(arr, low, mid, high)];
+    }
+
+    int step = n / 8;
+    int a = medianOf3(arr, low, low + step, low + 2 * step);
+    int b = medianOf3(arr, mid - step, mid, mid + step);
+    int c = medianOf3(arr, high - 2 * step, high - step, high);
+    return arr[medianOf3(arr, a, b, c)];
+}
+
+// Dutch national flag partition: afterwards arr[low..*lt-1] < pivot,
+// arr[*lt..*gt] == pivot and arr[*gt+1..high] > pivot
+static void partition3Way(int arr[], int low, int high, int pivot, int* lt, int* gt) {
+    int i = low;
+    *lt = low;
+    *gt = high;
+
+    while (i <= *gt) {
+        if (arr[i] < pivot) {
+            swap(&arr[i++], &arr[(*lt)++]);
+        } else if (arr[i] > pivot) {
+            swap(&arr[i], &arr[(*gt)--]);
+        } else {
+            i++;
+        }
+    }
+}
+
+static void introSortLoop(int arr[], int low, int high, int depthLimit) {
+    while (high - low + 1 > INSERTION_CUTOFF) {
+        if (depthLimit-- == 0) {
+            heapSortRange(arr, low, high);
+            return;
+        }
+
+        int lt, gt;
+        partition3Way(arr, low, high, choosePivot(arr, low, high), &lt, &gt);
+
+        // Recurse into the smaller side, loop on the larger: stack depth <= log2(n)
+        if (lt - low < high - gt) {
+            introSortLoop(arr, low, lt - 1, depthLimit);
+            low = gt + 1;
+        } else {
+            introSortLoop(arr, gt + 1, high, depthLimit);
+            high = lt - 1;
+        }
+    }
+    insertionSortRange(arr, low, high);
+}
+
+// Drop-in replacement for quickSort(arr, low, high)
+void introSort(int arr[], int low, int high) {
+    if (low >= high) return;
+
+    int depthLimit = 0;
+    for (int n = high - low + 1; n > 1; n >>= 1) depthLimit += 2;
+    introSortLoop(arr, low, high, depthLimit);
+}
+
+// ---------- branchless splitter tree ----------
+
+// Splitters in Eytzinger order: the children of tree[j] are tree[2j] and
+// tree[2j+1], so descending is one compare and one add per level.
+struct Classifier {
+    int tree[NUM_SPLITTERS];
+    int sorted[NUM_SPLITTERS];   // sorted[NUM_SPLITTERS - 1] is an INT_MAX sentinel
+};
+
+static void buildTree(struct Classifier* c, int* next, int j) {
+    if (j >= NUM_SPLITTERS) return;
+    buildTree(c, next, 2 * j);
+    c->tree[j] = c->sorted[(*next)++];
+    buildTree(c, next, 2 * j + 1);
+}
+
+// Bucket 2j holds keys between splitters j-1 and j, bucket 2j+1 keys equal
+// to splitter j. Equality buckets never need sorting, so a key frequent
+// enough to be sampled as a splitter costs one classification pass.
+static inline int classify(const struct Classifier* c, int x) {
+    int j = 1;
+    for (int level = 0; level < LOG_SPLITTERS; level++) {
+        j = 2 * j + (x > c->tree[j]);
+    }
+    j -= NUM_SPLITTERS;
+    return 2 * j + (x == c->sorted[j]);
+}
+
+// Four independent descents interleaved, so their loads overlap
+static inline void classify4(const struct Classifier* c, const int x[4], int out[4]) {
+    int j0 = 1, j1 = 1, j2 = 1, j3 = 1;
+    for (int level = 0; level < LOG_SPLITTERS; level++) {
+        j0 = 2 * j0 + (x[0] > c->tree[j0]);
+        j1 = 2 * j1 + (x[1] > c->tree[j1]);
+        j2 = 2 * j2 + (x[2] > c->tree[j2]);
+        j3 = 2 * j3 + (x[3] > c->tree[j3]);
+    }
+    j0 -= NUM_SPLITTERS;
+    j1 -= NUM_SPLITTERS;
+    j2 -= NUM_SPLITTERS;
+    j3 -= NUM_SPLITTERS;
+    out[0] = 2 * j0 + (x[0] == c->sorted[j0]);
+    out[1] = 2 * j1 + (x[1] == c->sorted[j1]);
+    out[2] = 2 * j2 + (x[2] == c->sorted[j2]);
+    out[3] = 2 * j3 + (x[3] == c->sorted[j3]);
+}
+
+// ---------- shared state ----------
+
+struct SampleWorker {
+    pthread_t thread;
+    int id;
+    struct SampleSort* sort;
+    int begin;                       // Stripe [begin, end), block aligned
+    int end;
+    int writePos;                    // Full blocks end here after classification
+    int* buffers;                    // NUM_BUCKETS partial blocks
+    int fill[NUM_BUCKETS];
+    long count[NUM_BUCKETS];
+    int blocks[2][BLOCK];            // Block in hand and the one it displaces
+};
+
+// Block indices; a bucket's unread blocks are [write, read]
+struct BucketPointers {
+    pthread_mutex_t lock;
+    long write;
+    long read;
+};
+
+struct SampleSort {
+    int* arr;
+    int n;
+    int threads;
+    struct Classifier classifier;
+    pthread_barrier_t barrier;
+    struct SampleWorker* workers;
+    long bucketStart[NUM_BUCKETS + 1];
+    struct BucketPointers pointers[NUM_BUCKETS];
+    int overflow[BLOCK];             // The one block slot that would run past n
+    int overflowBucket;
+    int* spill;                      // Per bucket: placed elements past its end
+    int spillCount[NUM_BUCKETS];
+    int nextBucket;                  // Work counter for the sorting phase
+};
+
+static long alignUp(long x) {
+    return (x + BLOCK - 1) / BLOCK * BLOCK;
+}
+
+// ---------- phase 1: local classification ----------
+
+// Each thread scans its stripe, collecting keys in one buffer block per
+// bucket. Full buffers are written back over the already-read front of
+// the stripe, so afterwards the stripe starts with full, single-bucket
+// blocks and the leftovers stay in the buffers.
+static void classifyStripe(struct SampleWorker* w) {
+    struct SampleSort* s = w->sort;
+    int* arr = s->arr;
+    int writePos = w->begin;
+    int i = w->begin;
+    int buckets[4];
+
+    memset(w->fill, 0, sizeof(w->fill));
+    memset(w->count, 0, sizeof(w->count));
+
+    for (; i < w->end; i += 4) {
+        int x[4];
+        int m = w->end - i < 4 ? w->end - i : 4;
+        for (int k = 0; k < 4; k++) x[k] = arr[i + (k < m ? k : 0)];
+        classify4(&s->classifier, x, buckets);
+
+        for (int k = 0; k < m; k++) {
+            int b = buckets[k];
+            w->buffers[b * BLOCK + w->fill[b]++] = x[k];
+            w->count[b]++;
+            if (w->fill[b] == BLOCK) {
+                memcpy(arr + writePos, w->buffers + b * BLOCK, BLOCK * sizeof(int));
+                writePos += BLOCK;
+                w->fill[b] = 0;
+            }
+        }
+    }
+    w->writePos = writePos;
+}
+
+// ---------- phase 2: bucket boundaries (one thread) ----------
+
+static void prepareBuckets(struct SampleSort* s) {
+    long total[NUM_BUCKETS] = {0};
+    for (int t = 0; t < s->threads; t++) {
+        for (int b = 0; b < NUM_BUCKETS; b++) total[b] += s->workers[t].count[b];
+    }
+    s->bucketStart[0] = 0;
+    for (int b = 0; b < NUM_BUCKETS; b++) s->bucketStart[b + 1] = s->bucketStart[b] + total[b];
+
+    // Gather every full block into [0, fullBlocks): the empty tails of the
+    // early stripes take blocks from the late ones. At most about one
+    // block per bucket per thread moves.
+    long fullBlocks = 0;
+    for (int t = 0; t < s->threads; t++) fullBlocks += (s->workers[t].writePos - s->workers[t].begin) / BLOCK;
+
+    int src = s->threads - 1;
+    long srcBlock = s->workers[src].writePos / BLOCK;   // One past the next block to take
+    for (int t = 0; t < s->threads; t++) {
+        struct SampleWorker* w = &s->workers[t];
+        for (long e = w->writePos / BLOCK; e < w->end / BLOCK && e < fullBlocks; e++) {
+            while (srcBlock == s->workers[src].begin / BLOCK) {
+                src--;
+                srcBlock = s->workers[src].writePos / BLOCK;
+            }
+            srcBlock--;
+            memcpy(s->arr + e * BLOCK, s->arr + srcBlock * BLOCK, BLOCK * sizeof(int));
+        }
+    }
+
+    // Bucket b owns block slots [alignUp(start b), alignUp(start b+1))
+    for (int b = 0; b < NUM_BUCKETS; b++) {
+        long first = alignUp(s->bucketStart[b]) / BLOCK;
+        long last = alignUp(s->bucketStart[b + 1]) / BLOCK;
+        s->pointers[b].write = first;
+        s->pointers[b].read = (last < fullBlocks ? last : fullBlocks) - 1;
+        if (s->pointers[b].read < first) s->pointers[b].read = first - 1;
+    }
+    s->overflowBucket = -1;
+    s->nextBucket = 0;
+}
+
+// ---------- phase 3: in-place block permutation ----------
+
+// Places a block at the next write slot of its bucket. If that slot still
+// holds an unread block, the two swap and the displaced block is placed
+// next, until one lands in a free slot. Slots are claimed under the
+// bucket's lock; the copy itself happens outside it.
+static void placeBlock(struct SampleWorker* w) {
+    struct SampleSort* s = w->sort;
+    int* cur = w->blocks[0];
+    int* other = w->blocks[1];
+
+    for (;;) {
+        int d = classify(&s->classifier, cur[0]);
+        struct BucketPointers* p = &s->pointers[d];
+
+        pthread_mutex_lock(&p->lock);
+        long slot = p->write++;
+        int occupied = slot <= p->read;
+        if (occupied) memcpy(other, s->arr + slot * BLOCK, BLOCK * sizeof(int));
+        pthread_mutex_unlock(&p->lock);
+
+        if (slot * BLOCK + BLOCK > s->n) {
+            // Only the slot straddling n can get here, and it is empty
+            memcpy(s->overflow, cur, BLOCK * sizeof(int));
+            s->overflowBucket = d;
+        } else {
+            memcpy(s->arr + slot * BLOCK, cur, BLOCK * sizeof(int));
+        }
+        if (!occupied) return;
+
+        int* temp = cur;
+        cur = other;
+        other = temp;
+    }
+}
+
+static void permuteBlocks(struct SampleWorker* w) {
+    struct SampleSort* s = w->sort;
+    int primary = (int)((long)w->id * NUM_BUCKETS / s->threads);
+
+    for (int i = 0; i < NUM_BUCKETS; i++) {
+        struct BucketPointers* p = &s->pointers[(primary + i) % NUM_BUCKETS];
+        for (;;) {
+            pthread_mutex_lock(&p->lock);
+            if (p->read < p->write) {
+                pthread_mutex_unlock(&p->lock);
+                break;
+            }
+            memcpy(w->blocks[0], s->arr + p->read * BLOCK, BLOCK * sizeof(int));
+            p->read--;
+            pthread_mutex_unlock(&p->lock);
+            placeBlock(w);
+        }
+    }
+}
+
+// ---------- phase 4: cleanup at bucket boundaries ----------
+
+// Bucket b's blocks fill [alignUp(start), write slot), which can run past
+// its true end into the next bucket's head. Step one saves that spill;
+// after a barrier, step two fills the bucket's free head and tail with
+// the spill, the overflow block and every thread's partial buffer.
+
+static long arrayLimit(const struct SampleSort* s, int b) {
+    if (s->overflowBucket == b) return (long)(s->n / BLOCK) * BLOCK;
+    return s->pointers[b].write * BLOCK;
+}
+
+static void saveSpill(struct SampleSort* s, int b) {
+    long first = alignUp(s->bucketStart[b]);
+    long end = s->bucketStart[b + 1];
+    long from = first > end ? first : end;
+    long to = arrayLimit(s, b);
+    s->spillCount[b] = 0;
+    if (to > from) {
+        memcpy(s->spill + (long)b * BLOCK, s->arr + from, (to - from) * sizeof(int));
+        s->spillCount[b] = (int)(to - from);
+    }
+}
+
+static void fillBucket(struct SampleSort* s, int b) {
+    long start = s->bucketStart[b];
+    long end = s->bucketStart[b + 1];
+    long first = alignUp(start);
+    long keepEnd = arrayLimit(s, b);
+    if (keepEnd > end) keepEnd = end;
+    if (keepEnd < first) keepEnd = first;
+
+    // Free slots: the head [start, first) and the tail [keepEnd, end)
+    long headEnd = first < end ? first : end;
+    long pos = start;
+    const int* sources[MAX_THREADS + 2];
+    int counts[MAX_THREADS + 2];
+    int numSources = 0;
+
+    sources[numSources] = s->spill + (long)b * BLOCK;
+    counts[numSources++] = s->spillCount[b];
+    if (s->overflowBucket == b) {
+        sources[numSources] = s->overflow;
+        counts[numSources++] = BLOCK;
+    }
+    for (int t = 0; t < s->threads; t++) {
+        sources[numSources] = s->workers[t].buffers + b * BLOCK;
+        counts[numSources++] = s->workers[t].fill[b];
+    }
+
+    for (int k = 0; k < numSources; k++) {
+        for (int i = 0; i < counts[k]; i++) {
+            if (pos == headEnd) pos = keepEnd;
+            s->arr[pos++] = sources[k][i];
+        }
+    }
+}
+
+// ---------- driver ----------
+
+static void sortBuckets(struct SampleSort* s) {
+    for (;;) {
+        int b = __atomic_fetch_add(&s->nextBucket, 1, __ATOMIC_RELAXED);
+        if (b >= NUM_BUCKETS) return;
+        if (b % 2 == 1) continue;   // Equality bucket: already sorted
+        introSort(s->arr, (int)s->bucketStart[b], (int)s->bucketStart[b + 1] - 1);
+    }
+}
+
+static void* sampleWorkerMain(void* arg) {
+    struct SampleWorker* w = (struct SampleWorker*)arg;
+    struct SampleSort* s = w->sort;
+
+    classifyStripe(w);
+    pthread_barrier_wait(&s->barrier);
+    if (w->id == 0) prepareBuckets(s);
+    pthread_barrier_wait(&s->barrier);
+
+    permuteBlocks(w);
+    pthread_barrier_wait(&s->barrier);
+
+    for (int b = w->id; b < NUM_BUCKETS; b += s->threads) saveSpill(s, b);
+    pthread_barrier_wait(&s->barrier);
+    for (int b = w->id; b < NUM_BUCKETS; b += s->threads) fillBucket(s, b);
+    pthread_barrier_wait(&s->barrier);
+
+    sortBuckets(s);
+    return NULL;
+}
+
+static uint32_t nextRandom(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+// Oversampling: the splitters are every OVERSAMPLE-th key of a sorted
+// random sample, which keeps bucket sizes within a small factor of n/k
+static void chooseSplitters(struct Classifier* c, const int arr[], int n) {
+    const int sampleSize = (NUM_SPLITTERS - 1) * OVERSAMPLE;
+    int* sample = (int*)malloc(sampleSize * sizeof(int));
+    uint32_t state = 2463534242u;
+
+    for (int i = 0; i < sampleSize; i++) sample[i] = arr[nextRandom(&state) % (uint32_t)n];
+    introSort(sample, 0, sampleSize - 1);
+    for (int i = 0; i < NUM_SPLITTERS - 1; i++) c->sorted[i] = sample[(i + 1) * OVERSAMPLE - 1];
+    c->sorted[NUM_SPLITTERS - 1] = INT_MAX;
+
+    int next = 0;
+    buildTree(c, &next, 1);
+    free(sample);
+}
+
+static int isSorted(const int arr[], int n) {
+    for (int i = 1; i < n; i++) {
+        if (arr[i - 1] > arr[i]) return 0;
+    }
+    return 1;
+}
+
+// Sorts arr[0..n-1] with the given number of threads
+void parallelSampleSort(int arr[], int n, int threads) {
+    if (isSorted(arr, n)) return;
+    if (n < SEQUENTIAL_CUTOFF) {
+        introSort(arr, 0, n - 1);
+        return;
+    }
+    if (threads < 1) threads = 1;
+    if (threads > MAX_THREADS) threads = MAX_THREADS;
+
+    struct SampleSort* s = (struct SampleSort*)malloc(sizeof(struct SampleSort));
+    s->arr = arr;
+    s->n = n;
+    s->threads = threads;
+    s->workers = (struct SampleWorker*)malloc(threads * sizeof(struct SampleWorker));
+    s->spill = (int*)malloc((size_t)NUM_BUCKETS * BLOCK * sizeof(int));
+    pthread_barrier_init(&s->barrier, NULL, threads);
+    for (int b = 0; b < NUM_BUCKETS; b++) pthread_mutex_init(&s->pointers[b].lock, NULL);
+    chooseSplitters(&s->classifier, arr, n);
+
+    for (int t = 0; t < threads; t++) {
+        struct SampleWorker* w = &s->workers[t];
+        w->id = t;
+        w->sort = s;
+        w->begin = (int)((long)n * t / threads / BLOCK * BLOCK);
+        w->end = t == threads - 1 ? n : (int)((long)n * (t + 1) / threads / BLOCK * BLOCK);
+        w->buffers = (int*)malloc((size_t)NUM_BUCKETS * BLOCK * sizeof(int));
+    }
+    for (int t = 1; t < threads; t++) pthread_create(&s->workers[t].thread, NULL, sampleWorkerMain, &s->workers[t]);
+    sampleWorkerMain(&s->workers[0]);
+    for (int t = 1; t < threads; t++) pthread_join(s->workers[t].thread, NULL);
+
+    for (int t = 0; t < threads; t++) free(s->workers[t].buffers);
+    for (int b = 0; b < NUM_BUCKETS; b++) pthread_mutex_destroy(&s->pointers[b].lock);
+    pthread_barrier_destroy(&s->barrier);
+    free(s->spill);
+    free(s->workers);
+    free(s);
+}
+
+void display(int arr[], int n) {
+    for (int i = 0; i < n; i++) {
+        printf("%d ", arr[i]);
+    }
+    printf("\n");
+}
+
+// ---------- correctness sweep and speedup benchmark ----------
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void fillInput(int arr[], int n, int shape) {
+    uint32_t state = 12345;
+    for (int i = 0; i < n; i++) {
+        uint32_t x = nextRandom(&state);
+        switch (shape) {
+            case 0: arr[i] = (int)x; break;          // random
+            case 1: arr[i] = i; break;               // sorted
+            case 2: arr[i] = n - i; break;           // reverse
+            case 3: arr[i] = (int)(x % 16); break;   // few unique
+            case 4: arr[i] = i % 1000 ? (int)x : INT_MAX; break;
+            case 5: arr[i] = (int)(x % 1000); break; // many duplicates, most not splitters
+            default: arr[i] = 7; break;              // all equal
+        }
+    }
+}
+
+// Sum and mixed sum catch dropped or duplicated elements
+static uint64_t fingerprint(const int arr[], int n) {
+    uint64_t sum = 0, mixed = 0;
+    for (int i = 0; i < n; i++) {
+        uint64_t x = (uint32_t)arr[i];
+        sum += x;
+        mixed += (x * 0x9E3779B97F4A7C15ull) ^ (x >> 7);
+    }
+    return sum ^ (mixed << 1);
+}
+
+int main(int argc, char* argv[]) {
+    int arr[] = {38, 27, 43, 3, 9, 82, 10, 3};
+    int n = sizeof(arr) / sizeof(arr[0]);
+
+    printf("Original array: ");
+    display(arr, n);
+
+    parallelSampleSort(arr, n, 4);
+
+    printf("Sorted array: ");
+    display(arr, n);
+
+    // Odd sizes exercise the partial last block and the overflow slot
+    const int sizes[] = {65536, 65537 + 100, 1000003, 4194304};
+    const int threadCounts[] = {1, 3, 8};
+    int failures = 0;
+    int* data = (int*)malloc(4194304 * sizeof(int));
+    for (int i = 0; i < 4; i++) {
+        for (int shape = 0; shape < 7; shape++) {
+            for (int t = 0; t < 3; t++) {
+                fillInput(data, sizes[i], shape);
+                uint64_t expected = fingerprint(data, sizes[i]);
+                parallelSampleSort(data, sizes[i], threadCounts[t]);
+                if (!isSorted(data, sizes[i]) || fingerprint(data, sizes[i]) != expected) {
+                    printf("FAILED: n=%d shape %d threads %d\n", sizes[i], shape, threadCounts[t]);
+                    failures++;
+                }
+            }
+        }
+    }
+    free(data);
+    printf("\nCorrectness sweep: %s\n", failures ? "FAILED" : "passed");
+
+    // Same table as parallel_merge_sort.c, for side-by-side runs, then
+    // again on 1000 distinct values: far more than the splitters can
+    // isolate, so the bucket sort itself has to handle the duplicates
+    int size = argc > 1 ? atoi(argv[1]) : 20000000;
+    int counts[] = {1, 2, 4, 8, 16, 32};
+    const int shapes[] = {0, 5};
+    const char* shapeNames[] = {"random ints", "ints mod 1000"};
+    data = (int*)malloc((size_t)size * sizeof(int));
+
+    for (int sh = 0; sh < 2; sh++) {
+        double baseline = 0;
+        printf("\n%d %s\n%8s %10s %8s\n", size, shapeNames[sh], "threads", "ms", "speedup");
+        for (int t = 0; t < 6; t++) {
+            fillInput(data, size, shapes[sh]);
+            double start = nowSeconds();
+            parallelSampleSort(data, size, counts[t]);
+            double ms = (nowSeconds() - start) * 1e3;
+            if (t == 0) baseline = ms;
+            printf("%8d %10.1f %7.2fx%s\n", counts[t], ms, baseline / ms, isSorted(data, size) ? "" : " UNSORTED");
+        }
+    }
+
+    free(data);
+    return failures != 0;
+}
@@ -0,0 +1,355 @@
+// Quickselect (nth element, partial sort, quantiles)
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+#define INSERTION_CUTOFF 16
+
+void swap(int* a, int* b) {
+    int temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+// ---------- partition and quickSort from quick_sort.c ----------
+
+int partition(int arr[], int low, int high) {
+    int pivot = arr[high];
+    int i = low - 1;
+
+    for (int j = low; j < high; j++) {
+        if (arr[j] < pivot) {
+            i++;
+            swap(&arr[i], &arr[j]);
+        }
+    }
+    swap(&arr[i + 1], &arr[high]);
+    return i + 1;
+}
+
+void quickSort(int arr[], int low, int high) {
+    if (low < high) {
+        int pi = partition(arr, low, high);
+        quickSort(arr, low, pi - 1);
+        quickSort(arr, pi + 1, high);
+    }
+}
+
+// ---------- building blocks ----------
+
+static void insertionSortRange(int arr[], int low, int high) {
+    for (int i = low + 1; i <= high; i++) {
+        int key = arr[i];
+        int j = i - 1;
+        while (j >= low && arr[j] > key) {
+            arr[j + 1] = arr[j];
+            j--;
+        }
+        arr[j + 1] = key;
+    }
+}
+
+// Moves the median of arr[low], arr[mid], arr[high] to arr[high], where
+// partition() takes its pivot
+static void medianOf3ToHigh(int arr[], int low, int high) {
+    int mid = low + (high - low) / 2;
+    if (arr[mid] < arr[low]) swap(&arr[mid], &arr[low]);
+    if (arr[high] < arr[low]) swap(&arr[high], &arr[low]);
+    if (arr[mid] < arr[high]) swap(&arr[mid], &arr[high]);
+}
+
+// Dutch national flag partition: afterwards arr[low..*lt-1] < pivot,
+// arr[*lt..*gt] == pivot and arr[*gt+1..high] > pivot
+static void partition3Way(int arr[], int low, int high, int pivot, int* lt, int* gt) {
+    int i = low;
+    *lt = low;
+    *gt = high;
+
+    while (i <= *gt) {
+        if (arr[i] < pivot) {
+            swap(&arr[i++], &arr[(*lt)++]);
+        } else if (arr[i] > pivot) {
+            swap(&arr[i], &arr[(*gt)--]);
+        } else {
+            i++;
+        }
+    }
+}
+
+static void selectRange(int arr[], int low, int high, const int ks[], int m, int guaranteed);
+
+// Median of medians of groups of five: a pivot with at least 30% of the
+// range on each side, which makes the fallback linear in the worst case
+static int medianOfMedians(int arr[], int low, int high) {
+    int groups = 0;
+    for (int g = low; g <= high; g += 5) {
+        int end = g + 4 < high ? g + 4 : high;
+        insertionSortRange(arr, g, end);
+        swap(&arr[low + groups], &arr[g + (end - g) / 2]);
+        groups++;
+    }
+    int mid = low + (groups - 1) / 2;
+    selectRange(arr, low, low + groups - 1, &mid, 1, 1);
+    return arr[mid];
+}
+
+// ---------- selection ----------
+
+// Introselect over several targets at once. ks are sorted positions
+// inside [low, high]. Each step partitions once and only keeps the sides
+// that still hold a target. Steps use partition() with a median-of-3
+// pivot until two steps in a row fail to halve the range; from then on
+// the median-of-medians pivot and a 3-way partition keep it O(n).
+static void selectRange(int arr[], int low, int high, const int ks[], int m, int guaranteed) {
+    int steps = 0;
+    int sizeBefore = high - low + 1;
+
+    while (m > 0 && low < high) {
+        if (high - low + 1 <= INSERTION_CUTOFF) {
+            insertionSortRange(arr, low, high);
+            return;
+        }
+
+        int lt, gt;
+        if (guaranteed) {
+            partition3Way(arr, low, high, medianOfMedians(arr, low, high), &lt, &gt);
+        } else {
+            medianOf3ToHigh(arr, low, high);
+            lt = gt = partition(arr, low, high);
+        }
+
+        // Targets below lt go left, above gt go right; the rest are done
+        int left = 0;
+        while (left < m && ks[left] < lt) left++;
+        int right = left;
+        while (right < m && ks[right] <= gt) right++;
+
+        if (left > 0) selectRange(arr, low, lt - 1, ks, left, guaranteed);
+        ks += right;
+        m -= right;
+        low = gt + 1;
+
+        if (!guaranteed && ++steps % 2 == 0) {
+            if (high - low + 1 > sizeBefore / 2) guaranteed = 1;
+            sizeBefore = high - low + 1;
+        }
+    }
+}
+
+// Rearranges arr so arr[k] is the k-th smallest (0-based), everything
+// before it is <= and everything after it >=. Returns arr[k].
+int nthElement(int arr[], int n, int k) {
+    selectRange(arr, 0, n - 1, &k, 1, 0);
+    return arr[k];
+}
+
+// Several order statistics in one pass: afterwards every arr[ks[i]] holds
+// the value nthElement would put there. ks may be in any order.
+void nthElements(int arr[], int n, const int ks[], int m) {
+    if (m <= 0) return;
+    int* sorted = (int*)malloc(m * sizeof(int));
+    memcpy(sorted, ks, m * sizeof(int));
+    insertionSortRange(sorted, 0, m - 1);
+    selectRange(arr, 0, n - 1, sorted, m, 0);
+    free(sorted);
+}
+
+// out[i] = value at quantile q[i] in [0, 1], nearest-rank
+void quantiles(int arr[], int n, const double q[], int m, int out[]) {
+    if (m <= 0) return;
+    int* ks = (int*)malloc(m * sizeof(int));
+    for (int i = 0; i < m; i++) ks[i] = (int)(q[i] * (n - 1) + 0.5);
+    int* sorted = (int*)malloc(m * sizeof(int));
+    memcpy(sorted, ks, m * sizeof(int));
+    insertionSortRange(sorted, 0, m - 1);
+    selectRange(arr, 0, n - 1, sorted, m, 0);
+    for (int i = 0; i < m; i++) out[i] = arr[ks[i]];
+    free(sorted);
+    free(ks);
+}
+
+static void siftDown(int arr[], int root, int size) {
+    int value = arr[root];
+    for (;;) {
+        int child = 2 * root + 1;
+        if (child >= size) break;
+        if (child + 1 < size && arr[child + 1] > arr[child]) child++;
+        if (arr[child] <= value) break;
+        arr[root] = arr[child];
+        root = child;
+    }
+    arr[root] = value;
+}
+
+// The k smallest elements, sorted, in arr[0..k-1]; the rest in any order.
+// Selection first, then a heap sort of the prefix: O(n + k log k).
+void partialSort(int arr[], int n, int k) {
+    if (k > n) k = n;
+    if (k <= 0) return;
+    if (k < n) nthElement(arr, n, k - 1);
+    for (int i = k / 2 - 1; i >= 0; i--) siftDown(arr, i, k);
+    for (int end = k - 1; end > 0; end--) {
+        swap(&arr[0], &arr[end]);
+        siftDown(arr, 0, end);
+    }
+}
+
+void display(int arr[], int n) {
+    for (int i = 0; i < n; i++) {
+        printf("%d ", arr[i]);
+    }
+    printf("\n");
+}
+
+// ---------- fuzz test and benchmark ----------
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t nextRandom(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+static int compareInts(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+static void fillInput(int arr[], int n, int shape, uint32_t seed) {
+    uint32_t state = seed;
+    for (int i = 0; i < n; i++) {
+        uint32_t x = nextRandom(&state);
+        switch (shape) {
+            case 0: arr[i] = (int)x; break;                   // random
+            case 1: arr[i] = i; break;                        // sorted
+            case 2: arr[i] = n - i; break;                    // reverse
+            case 3: arr[i] = (int)(x % 4); break;             // few unique
+            case 4: arr[i] = i < n / 2 ? i : n - i; break;    // organ pipe
+            default: arr[i] = 7; break;                       // all equal
+        }
+    }
+}
+
+// Every target holds the right value and the array is still a permutation
+static int fuzz(int rounds) {
+    uint32_t state = 99;
+    int* a = (int*)malloc(5000 * sizeof(int));
+    int* ref = (int*)malloc(5000 * sizeof(int));
+    int ok = 1;
+
+    for (int r = 0; r < rounds && ok; r++) {
+        int n = 1 + (int)(nextRandom(&state) % 5000);
+        fillInput(a, n, r % 6, nextRandom(&state) | 1);
+        memcpy(ref, a, n * sizeof(int));
+        qsort(ref, n, sizeof(int), compareInts);
+
+        int ks[8], m = 1 + (int)(nextRandom(&state) % 8);
+        for (int i = 0; i < m; i++) ks[i] = (int)(nextRandom(&state) % n);
+        int k = ks[0];
+
+        if (r % 3 == 0) {
+            nthElement(a, n, k);
+            for (int i = 0; i < n; i++) {
+                if ((i < k && a[i] > a[k]) || (i > k && a[i] < a[k])) ok = 0;
+            }
+            m = 1;
+        } else if (r % 3 == 1) {
+            nthElements(a, n, ks, m);
+        } else {
+            // Now and then ask for more than n: the whole array, sorted
+            int take = r % 4 == 2 ? n + 1 + k % 3 : k + 1;
+            partialSort(a, n, take);
+            if (memcmp(a, ref, (take < n ? take : n) * sizeof(int)) != 0) ok = 0;
+            m = 1;
+        }
+        for (int i = 0; i < m; i++) {
+            if (a[ks[i]] != ref[ks[i]]) ok = 0;
+        }
+        qsort(a, n, sizeof(int), compareInts);
+        if (memcmp(a, ref, n * sizeof(int)) != 0) ok = 0;
+    }
+    free(a);
+    free(ref);
+    return ok;
+}
+
+int main(int argc, char* argv[]) {
+    int arr[] = {10, 7, 8, 9, 1, 5, 3};
+    int n = sizeof(arr) / sizeof(arr[0]);
+
+    printf("Original array: ");
+    display(arr, n);
+
+    int median = nthElement(arr, n, n / 2);
+    printf("Median: %d\n", median);
+
+    partialSort(arr, n, 3);
+    printf("3 smallest: ");
+    display(arr, 3);
+
+    printf("\nFuzz test against qsort: %s\n", fuzz(3000) ? "passed" : "FAILED");
+
+    int size = argc > 1 ? atoi(argv[1]) : 10000000;
+    int* data = (int*)malloc((size_t)size * sizeof(int));
+    const double q[] = {0.01, 0.05, 0.25, 0.5, 0.75, 0.95, 0.99};
+    const int numQ = sizeof(q) / sizeof(q[0]);
+    int values[sizeof(q) / sizeof(q[0])];
+    double start, sortMs, ms;
+
+    // Sort-then-index baseline: the original quickSort, random input only
+    fillInput(data, size, 0, 12345);
+    start = nowSeconds();
+    quickSort(data, 0, size - 1);
+    sortMs = (nowSeconds() - start) * 1e3;
+
+    printf("\n%d random ints (ms)\n%-26s %10s %10s\n", size, "query", "select", "sort+index");
+
+    fillInput(data, size, 0, 12345);
+    start = nowSeconds();
+    nthElement(data, size, size / 2);
+    ms = (nowSeconds() - start) * 1e3;
+    printf("%-26s %10.1f %10.1f\n", "median (nthElement)", ms, sortMs);
+
+    fillInput(data, size, 0, 12345);
+    start = nowSeconds();
+    partialSort(data, size, 100);
+    ms = (nowSeconds() - start) * 1e3;
+    printf("%-26s %10.1f %10.1f\n", "top 100 (partialSort)", ms, sortMs);
+
+    fillInput(data, size, 0, 12345);
+    start = nowSeconds();
+    quantiles(data, size, q, numQ, values);
+    ms = (nowSeconds() - start) * 1e3;
+    printf("%-26s %10.1f %10.1f\n", "7 percentiles (one pass)", ms, sortMs);
+
+    ms = 0;
+    for (int i = 0; i < numQ; i++) {
+        fillInput(data, size, 0, 12345);
+        start = nowSeconds();
+        nthElement(data, size, (int)(q[i] * (size - 1) + 0.5));
+        ms += (nowSeconds() - start) * 1e3;
+    }
+    printf("%-26s %10.1f %10.1f\n", "7 percentiles (7 calls)", ms, sortMs);
+
+    // Inputs where a plain quickselect would go quadratic
+    const char* shapes[] = {"random", "sorted", "reverse", "few unique", "organ pipe", "all equal"};
+    printf("\nmedian by shape (ms)\n");
+    for (int shape = 0; shape < 6; shape++) {
+        fillInput(data, size, shape, 12345);
+        start = nowSeconds();
+        nthElement(data, size, size / 2);
+        printf("%-12s %8.1f\n", shapes[shape], (nowSeconds() - start) * 1e3);
+    }
+
+    free(data);
+    return 0;
+}
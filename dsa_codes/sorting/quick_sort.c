@@ -1,10 +1,19 @@
 // Quick Sort
 #include <stdio.h>
 
+// sort_benchmark.c defines SORT_LIBRARY and counting versions of these
+#ifndef SORT_LIBRARY
+#define LESS(a, b) ((a) < (b))
+#define COUNT_SWAP() ((void)0)
+#define ENTER() ((void)0)
+#define LEAVE() ((void)0)
+#endif
+
 void swap(int* a, int* b) {
     int temp = *a;
     *a = *b;
     *b = temp;
+    COUNT_SWAP();
 }
 
 int partition(int arr[], int low, int high) {
@@ -12,7 +21,7 @@ int partition(int arr[], int low, int high) {
     int i = low - 1;
     
     for (int j = low; j < high; j++) {
-        if (arr[j] < pivot) {
+        if (LESS(arr[j], pivot)) {
             i++;
             swap(&arr[i], &arr[j]);
         }
@@ -23,12 +32,15 @@ int partition(int arr[], int low, int high) {
 
 void quickSort(int arr[], int low, int high) {
     if (low < high) {
+        ENTER();
         int pi = partition(arr, low, high);
         quickSort(arr, low, pi - 1);
         quickSort(arr, pi + 1, high);
+        LEAVE();
     }
 }
 
+#ifndef SORT_LIBRARY
 void display(int arr[], int n) {
     for (int i = 0; i < n; i++) {
         printf("%d ", arr[i]);
@@ -50,3 +62,4 @@ int main() {
     
     return 0;
 }
+#endif
@@ -0,0 +1,270 @@
+// LSD Radix Sort for 32/64-bit integers
+// Build: gcc -O2 -pthread radix_sort.c
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+
+#define RADIX_BITS 8
+#define RADIX (1 << RADIX_BITS)
+#define DIGIT_MASK (RADIX - 1)
+#define MAX_THREADS 64
+
+// Flipping the sign bit maps signed order onto unsigned order, so
+// negative numbers sort before positive ones without a fix-up pass.
+#define SIGN32 0x80000000u
+#define SIGN64 0x8000000000000000ull
+
+static unsigned digit32(uint32_t x, int pass) {
+    return ((x ^ SIGN32) >> (pass * RADIX_BITS)) & DIGIT_MASK;
+}
+
+static unsigned digit64(uint64_t x, int pass) {
+    return (unsigned)(((x ^ SIGN64) >> (pass * RADIX_BITS)) & DIGIT_MASK);
+}
+
+// Same (arr, n) shape as insertionSort
+void radixSort(int arr[], int n) {
+    const int passes = 32 / RADIX_BITS;
+    size_t histogram[32 / RADIX_BITS][RADIX];
+    uint32_t* src = (uint32_t*)arr;
+    uint32_t* dst = (uint32_t*)malloc((size_t)n * sizeof(uint32_t));
+    uint32_t* scratch = dst;
+
+    // One read builds the histograms for every pass
+    memset(histogram, 0, sizeof(histogram));
+    for (int i = 0; i < n; i++) {
+        for (int p = 0; p < passes; p++) histogram[p][digit32(src[i], p)]++;
+    }
+
+    for (int p = 0; p < passes; p++) {
+        // Every key has the same digit: this pass would not move anything
+        if (n == 0 || histogram[p][digit32(src[0], p)] == (size_t)n) continue;
+
+        size_t offset[RADIX], sum = 0;
+        for (int d = 0; d < RADIX; d++) {
+            offset[d] = sum;
+            sum += histogram[p][d];
+        }
+        for (int i = 0; i < n; i++) {
+            dst[offset[digit32(src[i], p)]++] = src[i];
+        }
+
+        uint32_t* temp = src;
+        src = dst;
+        dst = temp;
+    }
+
+    if (src != (uint32_t*)arr) memcpy(arr, src, (size_t)n * sizeof(uint32_t));
+    free(scratch);
+}
+
+void radixSort64(int64_t arr[], size_t n) {
+    const int passes = 64 / RADIX_BITS;
+    size_t histogram[64 / RADIX_BITS][RADIX];
+    uint64_t* src = (uint64_t*)arr;
+    uint64_t* dst = (uint64_t*)malloc(n * sizeof(uint64_t));
+    uint64_t* scratch = dst;
+
+    memset(histogram, 0, sizeof(histogram));
+    for (size_t i = 0; i < n; i++) {
+        for (int p = 0; p < passes; p++) histogram[p][digit64(src[i], p)]++;
+    }
+
+    for (int p = 0; p < passes; p++) {
+        if (n == 0 || histogram[p][digit64(src[0], p)] == n) continue;
+
+        size_t offset[RADIX], sum = 0;
+        for (int d = 0; d < RADIX; d++) {
+            offset[d] = sum;
+            sum += histogram[p][d];
+        }
+        for (size_t i = 0; i < n; i++) {
+            dst[offset[digit64(src[i], p)]++] = src[i];
+        }
+
+        uint64_t* temp = src;
+        src = dst;
+        dst = temp;
+    }
+
+    if (src != (uint64_t*)arr) memcpy(arr, src, n * sizeof(uint64_t));
+    free(scratch);
+}
+
+// ---------- parallel variant ----------
+
+// Each thread owns a contiguous slice. Per pass it counts its slice's
+// digits, then scatters into offsets ordered by (digit, thread), which
+// keeps every pass stable.
+struct RadixWorker {
+    pthread_t thread;
+    const uint32_t* src;
+    uint32_t* dst;
+    int begin;
+    int end;
+    int pass;
+    int scatter;             // 0 = count phase, 1 = scatter phase
+    size_t histogram[32 / RADIX_BITS][RADIX];
+    size_t offset[RADIX];
+};
+
+static void* radixWorkerMain(void* arg) {
+    struct RadixWorker* w = (struct RadixWorker*)arg;
+
+    if (w->pass < 0) {
+        memset(w->histogram, 0, sizeof(w->histogram));
+        for (int i = w->begin; i < w->end; i++) {
+            for (int p = 0; p < 32 / RADIX_BITS; p++) w->histogram[p][digit32(w->src[i], p)]++;
+        }
+    } else if (!w->scatter) {
+        memset(w->histogram[w->pass], 0, sizeof(w->histogram[w->pass]));
+        for (int i = w->begin; i < w->end; i++) w->histogram[w->pass][digit32(w->src[i], w->pass)]++;
+    } else {
+        for (int i = w->begin; i < w->end; i++) {
+            w->dst[w->offset[digit32(w->src[i], w->pass)]++] = w->src[i];
+        }
+    }
+    return NULL;
+}
+
+static void runPhase(struct RadixWorker workers[], int threads) {
+    for (int t = 0; t < threads; t++) pthread_create(&workers[t].thread, NULL, radixWorkerMain, &workers[t]);
+    for (int t = 0; t < threads; t++) pthread_join(workers[t].thread, NULL);
+}
+
+void radixSortParallel(int arr[], int n, int threads) {
+    const int passes = 32 / RADIX_BITS;
+    if (threads < 1) threads = 1;
+    if (threads > MAX_THREADS) threads = MAX_THREADS;
+
+    struct RadixWorker* workers = (struct RadixWorker*)malloc(threads * sizeof(struct RadixWorker));
+    uint32_t* src = (uint32_t*)arr;
+    uint32_t* dst = (uint32_t*)malloc((size_t)n * sizeof(uint32_t));
+    uint32_t* scratch = dst;
+
+    for (int t = 0; t < threads; t++) {
+        workers[t].begin = (int)((long)n * t / threads);
+        workers[t].end = (int)((long)n * (t + 1) / threads);
+        workers[t].src = src;
+        workers[t].pass = -1;
+    }
+    runPhase(workers, threads);
+
+    for (int p = 0; p < passes; p++) {
+        size_t total = 0;
+        for (int t = 0; t < threads; t++) {
+            if (n > 0) total += workers[t].histogram[p][digit32(src[0], p)];
+        }
+        if (n == 0 || total == (size_t)n) continue;
+
+        // Totals per digit never change, but each slice's share does once
+        // data has moved, so every pass recounts before scattering.
+        for (int t = 0; t < threads; t++) {
+            workers[t].src = src;
+            workers[t].dst = dst;
+            workers[t].pass = p;
+            workers[t].scatter = 0;
+        }
+        runPhase(workers, threads);
+
+        size_t sum = 0;
+        for (int d = 0; d < RADIX; d++) {
+            for (int t = 0; t < threads; t++) {
+                workers[t].offset[d] = sum;
+                sum += workers[t].histogram[p][d];
+            }
+        }
+        for (int t = 0; t < threads; t++) workers[t].scatter = 1;
+        runPhase(workers, threads);
+
+        uint32_t* temp = src;
+        src = dst;
+        dst = temp;
+    }
+
+    if (src != (uint32_t*)arr) memcpy(arr, src, (size_t)n * sizeof(uint32_t));
+    free(scratch);
+    free(workers);
+}
+
+void display(int arr[], int n) {
+    for (int i = 0; i < n; i++) {
+        printf("%d ", arr[i]);
+    }
+    printf("\n");
+}
+
+// ---------- benchmark ----------
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int compareInts(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+
+static void fillRandom(int arr[], int n, int range) {
+    unsigned int state = 12345;
+    for (int i = 0; i < n; i++) {
+        state = state * 1103515245u + 12345u;
+        arr[i] = range > 0 ? (int)(state >> 8) % range : (int)(state ^ (state << 16));
+    }
+}
+
+static int isSorted(const int arr[], int n) {
+    for (int i = 1; i < n; i++) {
+        if (arr[i - 1] > arr[i]) return 0;
+    }
+    return 1;
+}
+
+int main(int argc, char* argv[]) {
+    int arr[] = {170, -45, 75, -90, 802, 24, 2, 66, 0};
+    int n = sizeof(arr) / sizeof(arr[0]);
+
+    printf("Original array: ");
+    display(arr, n);
+
+    radixSort(arr, n);
+
+    printf("Sorted array: ");
+    display(arr, n);
+
+    int64_t wide[] = {5000000000ll, -7, 42, -5000000000ll, 0};
+    radixSort64(wide, 5);
+    printf("Sorted 64-bit: ");
+    for (int i = 0; i < 5; i++) printf("%lld ", (long long)wide[i]);
+    printf("\n");
+
+    int size = argc > 1 ? atoi(argv[1]) : 10000000;
+    int* data = (int*)malloc((size_t)size * sizeof(int));
+    const char* inputs[] = {"full 32-bit", "0..65535"};
+    int ranges[] = {0, 65536};   // Small range: the top two passes are skipped
+
+    printf("\n%d ints (ms)\n%-12s %8s %8s %10s %10s\n", size, "keys", "qsort", "radix", "radix x4", "radix x16");
+    for (int r = 0; r < 2; r++) {
+        double ms[4];
+        int ok = 1;
+        for (int s = 0; s < 4; s++) {
+            fillRandom(data, size, ranges[r]);
+            double start = nowSeconds();
+            if (s == 0) qsort(data, size, sizeof(int), compareInts);
+            else if (s == 1) radixSort(data, size);
+            else radixSortParallel(data, size, s == 2 ? 4 : 16);
+            ms[s] = (nowSeconds() - start) * 1e3;
+            ok &= isSorted(data, size);
+        }
+        printf("%-12s %8.1f %8.1f %10.1f %10.1f%s\n", inputs[r], ms[0], ms[1], ms[2], ms[3], ok ? "" : " UNSORTED");
+    }
+
+    free(data);
+    return 0;
+}
@@ -1,11 +1,17 @@
 // Selection Sort
 #include <stdio.h>
 
+// sort_benchmark.c defines SORT_LIBRARY and counting versions of these
+#ifndef SORT_LIBRARY
+#define LESS(a, b) ((a) < (b))
+#define COUNT_SWAP() ((void)0)
+#endif
+
 void selectionSort(int arr[], int n) {
     for (int i = 0; i < n - 1; i++) {
         int minIdx = i;
         for (int j = i + 1; j < n; j++) {
-            if (arr[j] < arr[minIdx]) {
+            if (LESS(arr[j], arr[minIdx])) {
                 minIdx = j;
             }
         }
@@ -13,10 +19,12 @@ void selectionSort(int arr[], int n) {
             int temp = arr[i];
             arr[i] = arr[minIdx];
             arr[minIdx] = temp;
+            COUNT_SWAP();
         }
     }
 }
 
+#ifndef SORT_LIBRARY
 void display(int arr[], int n) {
     for (int i = 0; i < n; i++) {
         printf("%d ", arr[i]);
@@ -38,3 +46,4 @@ int main() {
     
     return 0;
 }
+#endif
@@ -0,0 +1,391 @@
+// SIMD Quick Sort (AVX2 / AVX-512 partition with runtime dispatch)
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_X86 1
+#endif
+
+#define INSERTION_CUTOFF 32
+#define MAX_LANES 16
+
+void swap(int* a, int* b) {
+    int temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+// ---------- original Quick Sort, the fuzz-test reference ----------
+
+int partition(int arr[], int low, int high) {
+    int pivot = arr[high];
+    int i = low - 1;
+
+    for (int j = low; j < high; j++) {
+        if (arr[j] < pivot) {
+            i++;
+            swap(&arr[i], &arr[j]);
+        }
+    }
+    swap(&arr[i + 1], &arr[high]);
+    return i + 1;
+}
+
+void quickSort(int arr[], int low, int high) {
+    if (low < high) {
+        int pi = partition(arr, low, high);
+        quickSort(arr, low, pi - 1);
+        quickSort(arr, pi + 1, high);
+    }
+}
+
+// ---------- partition kernels ----------
+//
+// Every kernel rearranges arr[lo..hi) so elements < pivot come first and
+// returns where the >= pivot part starts.
+
+// Branchless Lomuto: always swap, advance the boundary only on a match
+static int partitionScalar(int arr[], int lo, int hi, int pivot) {
+    int i = lo;
+    for (int j = lo; j < hi; j++) {
+        int x = arr[j];
+        arr[j] = arr[i];
+        arr[i] = x;
+        i += x < pivot;
+    }
+    return i;
+}
+
+// Distributes up to 3 vectors' worth of leftovers into the final gap
+static void partitionLeftovers(const int tmp[], int count, int arr[], int* writeLeft, int* writeRight, int pivot) {
+    for (int i = 0; i < count; i++) {
+        if (tmp[i] < pivot) arr[(*writeLeft)++] = tmp[i];
+        else arr[--(*writeRight)] = tmp[i];
+    }
+}
+
+#ifdef HAVE_X86
+
+// Both SIMD kernels use the in-place scheme of Bramas' AVX-512 sort: set
+// the first and last vectors aside, which opens a gap of two vectors.
+// Each step loads from the side with less free room and writes the
+// vector's smaller elements at the left gap and the rest at the right gap,
+// so each side always has at least one vector of room.
+
+static int permuteTable[256][8];   // AVX2 stand-in for compress-store
+
+static void initPermuteTable() {
+    for (int mask = 0; mask < 256; mask++) {
+        int k = 0;
+        for (int lane = 0; lane < 8; lane++) {
+            if (mask & (1 << lane)) permuteTable[mask][k++] = lane;
+        }
+        for (int lane = 0; lane < 8; lane++) {
+            if (!(mask & (1 << lane))) permuteTable[mask][k++] = lane;
+        }
+    }
+}
+
+__attribute__((target("avx2")))
+static int partitionAvx2(int arr[], int lo, int hi, int pivot) {
+    const int W = 8;
+    if (hi - lo < 2 * W) return partitionScalar(arr, lo, hi, pivot);
+
+    int tmp[3 * 8];
+    memcpy(tmp, arr + lo, W * sizeof(int));
+    memcpy(tmp + W, arr + hi - W, W * sizeof(int));
+    int left = lo + W, right = hi - W;
+    int writeLeft = lo, writeRight = hi;
+    __m256i pivotVec = _mm256_set1_epi32(pivot);
+
+    while (right - left >= W) {
+        __m256i v;
+        if (left - writeLeft <= writeRight - right) {
+            v = _mm256_loadu_si256((const __m256i*)(arr + left));
+            left += W;
+        } else {
+            right -= W;
+            v = _mm256_loadu_si256((const __m256i*)(arr + right));
+        }
+
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(pivotVec, v)));
+        int nLeft = __builtin_popcount(mask);
+        __m256i idx = _mm256_loadu_si256((const __m256i*)permuteTable[mask]);
+        __m256i packed = _mm256_permutevar8x32_epi32(v, idx);
+
+        // Lanes [0, nLeft) are < pivot, the rest >= pivot; each full
+        // store spills into free room only
+        _mm256_storeu_si256((__m256i*)(arr + writeLeft), packed);
+        _mm256_storeu_si256((__m256i*)(arr + writeRight - W), packed);
+        writeLeft += nLeft;
+        writeRight -= W - nLeft;
+    }
+
+    int rest = right - left;
+    memcpy(tmp + 2 * W, arr + left, rest * sizeof(int));
+    partitionLeftovers(tmp, 2 * W + rest, arr, &writeLeft, &writeRight, pivot);
+    return writeLeft;
+}
+
+__attribute__((target("avx512f")))
+static int partitionAvx512(int arr[], int lo, int hi, int pivot) {
+    const int W = 16;
+    if (hi - lo < 2 * W) return partitionScalar(arr, lo, hi, pivot);
+
+    int tmp[3 * 16];
+    memcpy(tmp, arr + lo, W * sizeof(int));
+    memcpy(tmp + W, arr + hi - W, W * sizeof(int));
+    int left = lo + W, right = hi - W;
+    int writeLeft = lo, writeRight = hi;
+    __m512i pivotVec = _mm512_set1_epi32(pivot);
+
+    while (right - left >= W) {
+        __m512i v;
+        if (left - writeLeft <= writeRight - right) {
+            v = _mm512_loadu_si512(arr + left);
+            left += W;
+        } else {
+            right -= W;
+            v = _mm512_loadu_si512(arr + right);
+        }
+
+        __mmask16 less = _mm512_cmplt_epi32_mask(v, pivotVec);
+        int nLeft = __builtin_popcount(less);
+        _mm512_mask_compressstoreu_epi32(arr + writeLeft, less, v);
+        writeRight -= W - nLeft;
+        _mm512_mask_compressstoreu_epi32(arr + writeRight, (__mmask16)~less, v);
+        writeLeft += nLeft;
+    }
+
+    int rest = right - left;
+    memcpy(tmp + 2 * W, arr + left, rest * sizeof(int));
+    partitionLeftovers(tmp, 2 * W + rest, arr, &writeLeft, &writeRight, pivot);
+    return writeLeft;
+}
+
+#endif
+
+typedef int (*PartitionKernel)(int arr[], int lo, int hi, int pivot);
+
+static PartitionKernel partitionKernel = partitionScalar;
+static const char* kernelName = "scalar";
+
+// Picks the widest kernel this CPU supports; safe to call repeatedly
+void initSimdSort() {
+#ifdef HAVE_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        partitionKernel = partitionAvx512;
+        kernelName = "avx512";
+    } else if (__builtin_cpu_supports("avx2")) {
+        initPermuteTable();
+        partitionKernel = partitionAvx2;
+        kernelName = "avx2";
+    }
+#endif
+}
+
+// ---------- sort driver ----------
+
+static void insertionSortRange(int arr[], int lo, int hi) {
+    for (int i = lo + 1; i < hi; i++) {
+        int key = arr[i];
+        int j = i - 1;
+        while (j >= lo && arr[j] > key) {
+            arr[j + 1] = arr[j];
+            j--;
+        }
+        arr[j + 1] = key;
+    }
+}
+
+static void siftDown(int arr[], int base, int root, int size) {
+    int value = arr[base + root];
+    for (;;) {
+        int child = 2 * root + 1;
+        if (child >= size) break;
+        if (child + 1 < size && arr[base + child + 1] > arr[base + child]) child++;
+        if (arr[base + child] <= value) break;
+        arr[base + root] = arr[base + child];
+        root = child;
+    }
+    arr[base + root] = value;
+}
+
+// Depth-limit fallback, as in introSort
+static void heapSortRange(int arr[], int lo, int hi) {
+    int size = hi - lo;
+    for (int i = size / 2 - 1; i >= 0; i--) {
+        siftDown(arr, lo, i, size);
+    }
+    for (int end = size - 1; end > 0; end--) {
+        swap(&arr[lo], &arr[lo + end]);
+        siftDown(arr, lo, 0, end);
+    }
+}
+
+static int medianOf3(int a, int b, int c) {
+    if (a < b) return b < c ? b : (a < c ? c : a);
+    return a < c ? a : (b < c ? c : b);
+}
+
+static void simdSortLoop(int arr[], int lo, int hi, int depthLimit) {
+    while (hi - lo > INSERTION_CUTOFF) {
+        if (depthLimit-- == 0) {
+            heapSortRange(arr, lo, hi);
+            return;
+        }
+
+        int pivot = medianOf3(arr[lo], arr[lo + (hi - lo) / 2], arr[hi - 1]);
+        int mid = partitionKernel(arr, lo, hi, pivot);
+
+        // Pivot was the minimum: split off the run equal to it instead
+        if (mid == lo) {
+            mid = pivot == INT32_MAX ? hi : partitionKernel(arr, lo, hi, pivot + 1);
+            lo = mid;
+            continue;
+        }
+
+        if (mid - lo < hi - mid) {
+            simdSortLoop(arr, lo, mid, depthLimit);
+            lo = mid;
+        } else {
+            simdSortLoop(arr, mid, hi, depthLimit);
+            hi = mid;
+        }
+    }
+    insertionSortRange(arr, lo, hi);
+}
+
+// Same shape as quickSort(arr, low, high); call initSimdSort() first
+void simdQuickSort(int arr[], int low, int high) {
+    if (low >= high) return;
+    int depthLimit = 0;
+    for (int n = high - low + 1; n > 1; n >>= 1) depthLimit += 2;
+    simdSortLoop(arr, low, high + 1, depthLimit);
+}
+
+void display(int arr[], int n) {
+    for (int i = 0; i < n; i++) {
+        printf("%d ", arr[i]);
+    }
+    printf("\n");
+}
+
+// ---------- fuzz test and benchmark ----------
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t nextRandom(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+// Random sizes, value ranges and presorted shapes, checked against quickSort
+static int fuzz(int rounds) {
+    uint32_t state = 2463534242u;
+    int* a = (int*)malloc(4096 * sizeof(int));
+    int* b = (int*)malloc(4096 * sizeof(int));
+
+    for (int r = 0; r < rounds; r++) {
+        int n = (int)(nextRandom(&state) % 4096);
+        uint32_t range = 1u << (nextRandom(&state) % 32);
+        int shape = (int)(nextRandom(&state) % 4);
+        for (int i = 0; i < n; i++) {
+            uint32_t x = nextRandom(&state);
+            a[i] = range == 0x80000000u ? (int)x : (int)(x % range) - (int)(range / 2);
+            if (shape == 1) a[i] = i;
+            if (shape == 2) a[i] = n - i;
+            if (shape == 3 && i % 3) a[i] = INT32_MAX;
+        }
+        memcpy(b, a, n * sizeof(int));
+
+        simdQuickSort(a, 0, n - 1);
+        if (n < 1024 || shape == 0) quickSort(b, 0, n - 1);   // Reference is quadratic on shapes 1-3
+        else insertionSortRange(b, 0, n);
+
+        if (memcmp(a, b, n * sizeof(int)) != 0) {
+            printf("fuzz mismatch in round %d (n=%d, shape %d)\n", r, n, shape);
+            free(a);
+            free(b);
+            return 0;
+        }
+    }
+    free(a);
+    free(b);
+    return 1;
+}
+
+static void benchmark(const char* name, void (*sort)(int[], int, int), int n) {
+    int* arr = (int*)malloc(n * sizeof(int));
+    uint32_t state = 12345;
+    for (int i = 0; i < n; i++) arr[i] = (int)nextRandom(&state);
+
+    double start = nowSeconds();
+    sort(arr, 0, n - 1);
+    double ms = (nowSeconds() - start) * 1e3;
+
+    int sorted = 1;
+    for (int i = 1; i < n; i++) {
+        if (arr[i - 1] > arr[i]) sorted = 0;
+    }
+    printf("%-18s %8.1f ms%s\n", name, ms, sorted ? "" : " UNSORTED");
+    free(arr);
+}
+
+int main(int argc, char* argv[]) {
+    int arr[] = {10, 7, 8, 9, 1, 5};
+    int n = sizeof(arr) / sizeof(arr[0]);
+
+    initSimdSort();
+
+    printf("Original array: ");
+    display(arr, n);
+
+    simdQuickSort(arr, 0, n - 1);
+
+    printf("Sorted array: ");
+    display(arr, n);
+
+    // Fuzz every kernel this CPU can run, widest first
+    PartitionKernel kernels[3];
+    const char* names[3];
+    int count = 0;
+    kernels[count] = partitionKernel;
+    names[count++] = kernelName;
+#ifdef HAVE_X86
+    if (partitionKernel == partitionAvx512 && __builtin_cpu_supports("avx2")) {
+        initPermuteTable();
+        kernels[count] = partitionAvx2;
+        names[count++] = "avx2";
+    }
+#endif
+    if (partitionKernel != partitionScalar) {
+        kernels[count] = partitionScalar;
+        names[count++] = "scalar";
+    }
+
+    int size = argc > 1 ? atoi(argv[1]) : 10000000;
+    printf("\n%d random ints\n", size);
+    benchmark("quickSort", quickSort, size);
+    for (int k = 0; k < count; k++) {
+        partitionKernel = kernels[k];
+        int ok = fuzz(2000);
+        char label[32];
+        snprintf(label, sizeof(label), "simdQuickSort/%s", names[k]);
+        printf("fuzz %-6s %s\n", names[k], ok ? "passed" : "FAILED");
+        benchmark(label, simdQuickSort, size);
+    }
+
+    return 0;
+}
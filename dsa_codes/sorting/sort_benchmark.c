@@ -0,0 +1,307 @@
+// Sorting Benchmark Suite (every sort across input shapes and sizes)
+// Build: gcc -O2 sort_benchmark.c   (includes the sorts' own .c files)
+// Usage: ./sort_benchmark [maxSize] [table|csv|json]
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <sys/resource.h>
+
+// Sorts with quadratic cases only run up to this size on those cases
+#define QUADRATIC_CAP 4096
+#define MIN_SAMPLE_ELEMENTS 1000000   // Small sizes repeat until this many elements are sorted
+
+// ---------- instrumentation ----------
+
+// Counters stay on during timing. They live in globals that never alias
+// the int arrays, so the compiler keeps them in registers inside the loops
+// and every sort pays about the same small cost.
+struct SortStats {
+    uint64_t comparisons;
+    uint64_t swaps;          // Exchanges of two elements
+    uint64_t moves;          // Single element writes (shifts, merge output)
+    size_t heapBytes;        // Scratch memory currently allocated
+    size_t peakHeapBytes;
+    int depth;
+    int maxDepth;            // Deepest recursion
+};
+
+static struct SortStats stats;
+
+static void* scratchAlloc(size_t bytes) {
+    stats.heapBytes += bytes;
+    if (stats.heapBytes > stats.peakHeapBytes) stats.peakHeapBytes = stats.heapBytes;
+    return malloc(bytes);
+}
+
+static void scratchFree(void* p, size_t bytes) {
+    stats.heapBytes -= bytes;
+    free(p);
+}
+
+static void enter() {
+    if (++stats.depth > stats.maxDepth) stats.maxDepth = stats.depth;
+}
+
+static void leave() {
+    stats.depth--;
+}
+
+// ---------- the sorts, from their own files ----------
+//
+// With SORT_LIBRARY defined each file contributes only its sort; its
+// display() and main() drop out, and the hooks below replace the no-op
+// defaults it would otherwise define.
+
+#define SORT_LIBRARY
+#define LESS(a, b) (stats.comparisons++, (a) < (b))
+#define COUNT_SWAP() (stats.swaps++)
+#define COUNT_MOVES(k) (stats.moves += (uint64_t)(k))
+#define ENTER() enter()
+#define LEAVE() leave()
+#define SCRATCH_ALLOC(bytes) scratchAlloc(bytes)
+#define SCRATCH_FREE(p, bytes) scratchFree(p, bytes)
+
+#include "bubble_sort.c"
+#include "selection_sort.c"
+#include "insertion_sort.c"
+#include "merge_sort.c"
+#include "quick_sort.c"
+
+static void mergeSortN(int arr[], int n) {
+    mergeSort(arr, 0, n - 1);
+}
+
+static void quickSortN(int arr[], int n) {
+    quickSort(arr, 0, n - 1);
+}
+
+static int compareInts(const void* a, const void* b) {
+    int x = *(const int*)a, y = *(const int*)b;
+    stats.comparisons++;
+    return (x > y) - (x < y);
+}
+
+// libc baseline
+static void qsortN(int arr[], int n) {
+    qsort(arr, n, sizeof(int), compareInts);
+}
+
+// ---------- inputs ----------
+
+enum Shape { RANDOM, SORTED, REVERSE, FEW_UNIQUE, ORGAN_PIPE, NEARLY_SORTED, NUM_SHAPES };
+
+static const char* shapeNames[NUM_SHAPES] = {
+    "random", "sorted", "reverse", "few-unique", "organ-pipe", "nearly-sorted"
+};
+
+struct SortEntry {
+    const char* name;
+    void (*sort)(int arr[], int n);
+    int quadraticOnRandom;   // Capped on every shape, not just presorted ones
+    int quadraticOnOrdered;  // Capped on all shapes except random
+};
+
+static const struct SortEntry sorts[] = {
+    { "bubble",    bubbleSort,    1, 0 },   // Sorted input exits after one pass
+    { "selection", selectionSort, 1, 1 },
+    { "insertion", insertionSort, 1, 0 },
+    { "merge",     mergeSortN,    0, 0 },
+    { "quick",     quickSortN,    0, 1 },   // Last-element pivot: ordered and duplicate-heavy input is O(n^2)
+    { "qsort",     qsortN,        0, 0 },
+};
+
+#define NUM_SORTS (int)(sizeof(sorts) / sizeof(sorts[0]))
+
+static uint32_t nextRandom(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+static void fillInput(int arr[], int n, enum Shape shape) {
+    uint32_t state = 2463534242u;
+    for (int i = 0; i < n; i++) {
+        switch (shape) {
+            case RANDOM:        arr[i] = (int)nextRandom(&state); break;
+            case SORTED:        arr[i] = i; break;
+            case REVERSE:       arr[i] = n - i; break;
+            case FEW_UNIQUE:    arr[i] = (int)(nextRandom(&state) % 16); break;
+            case ORGAN_PIPE:    arr[i] = i < n / 2 ? i : n - i; break;
+            case NEARLY_SORTED: arr[i] = i; break;
+            default: break;
+        }
+    }
+    // 1% of positions swapped with a random partner
+    if (shape == NEARLY_SORTED && n > 1) {
+        for (int k = 0; k < n / 100 + 1; k++) {
+            int a = (int)(nextRandom(&state) % n), b = (int)(nextRandom(&state) % n);
+            int temp = arr[a];
+            arr[a] = arr[b];
+            arr[b] = temp;
+        }
+    }
+}
+
+// Order-independent fingerprint, so a sort that drops or duplicates
+// elements is caught even when its output is ordered
+static uint64_t fingerprint(const int arr[], int n) {
+    uint64_t sum = 0, mixed = 0;
+    for (int i = 0; i < n; i++) {
+        uint64_t x = (uint32_t)arr[i];
+        sum += x;
+        mixed += (x * 0x9E3779B97F4A7C15ull) ^ (x >> 7);
+    }
+    return sum ^ (mixed << 1);
+}
+
+static int isSorted(const int arr[], int n) {
+    for (int i = 1; i < n; i++) {
+        if (arr[i - 1] > arr[i]) return 0;
+    }
+    return 1;
+}
+
+// ---------- driver ----------
+
+enum Format { TABLE, CSV, JSON };
+
+struct Result {
+    const char* sortName;
+    const char* shapeName;
+    int n;
+    int reps;
+    double nsPerElement;
+    struct SortStats stats;   // From the last repetition
+    int ok;
+};
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void runOne(const struct SortEntry* entry, enum Shape shape, const int input[], int work[], int n,
+                   uint64_t expected, struct Result* out) {
+    int reps = n >= MIN_SAMPLE_ELEMENTS ? 1 : MIN_SAMPLE_ELEMENTS / n;
+    if ((entry->quadraticOnRandom || (entry->quadraticOnOrdered && shape != RANDOM)) && reps > 1) {
+        reps = reps / 64 + 1;   // Quadratic work per element: fewer repetitions
+    }
+
+    double seconds = 0;
+    int ok = 1;
+    for (int r = 0; r < reps; r++) {
+        memcpy(work, input, (size_t)n * sizeof(int));
+        memset(&stats, 0, sizeof(stats));
+        double start = nowSeconds();
+        entry->sort(work, n);
+        seconds += nowSeconds() - start;
+    }
+    ok = isSorted(work, n) && fingerprint(work, n) == expected;
+
+    out->sortName = entry->name;
+    out->shapeName = shapeNames[shape];
+    out->n = n;
+    out->reps = reps;
+    out->nsPerElement = seconds * 1e9 / ((double)n * reps);
+    out->stats = stats;
+    out->ok = ok;
+}
+
+static void printResult(const struct Result* r, enum Format format, int first) {
+    const struct SortStats* s = &r->stats;
+    switch (format) {
+        case TABLE:
+            printf("%-10s %-14s %11d %10.2f %14llu %14llu %14llu %12zu %6d%s\n",
+                   r->sortName, r->shapeName, r->n, r->nsPerElement,
+                   (unsigned long long)s->comparisons, (unsigned long long)s->swaps,
+                   (unsigned long long)s->moves, s->peakHeapBytes, s->maxDepth, r->ok ? "" : "  UNSORTED");
+            break;
+        case CSV:
+            printf("%s,%s,%d,%d,%.3f,%llu,%llu,%llu,%zu,%d,%d\n",
+                   r->sortName, r->shapeName, r->n, r->reps, r->nsPerElement,
+                   (unsigned long long)s->comparisons, (unsigned long long)s->swaps,
+                   (unsigned long long)s->moves, s->peakHeapBytes, s->maxDepth, r->ok);
+            break;
+        case JSON:
+            printf("%s\n    {\"sort\": \"%s\", \"shape\": \"%s\", \"n\": %d, \"reps\": %d, "
+                   "\"nsPerElement\": %.3f, \"comparisons\": %llu, \"swaps\": %llu, \"moves\": %llu, "
+                   "\"peakHeapBytes\": %zu, \"maxDepth\": %d, \"sorted\": %s}",
+                   first ? "" : ",", r->sortName, r->shapeName, r->n, r->reps, r->nsPerElement,
+                   (unsigned long long)s->comparisons, (unsigned long long)s->swaps,
+                   (unsigned long long)s->moves, s->peakHeapBytes, s->maxDepth, r->ok ? "true" : "false");
+            break;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    // Sizes go up to 10^9 (8 GB for input plus work copy); argv caps them
+    const long sizes[] = {16, 256, 4096, 65536, 1000000, 16000000, 100000000, 1000000000};
+    long maxSize = argc > 1 ? atol(argv[1]) : 1000000;
+    enum Format format = TABLE;
+    if (argc > 2 && strcmp(argv[2], "csv") == 0) format = CSV;
+    if (argc > 2 && strcmp(argv[2], "json") == 0) format = JSON;
+
+    int largest = 0;
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        if (sizes[i] <= maxSize) largest = (int)sizes[i];
+    }
+    if (largest == 0) {
+        fprintf(stderr, "maxSize must be at least %ld\n", sizes[0]);
+        return 1;
+    }
+
+    int* input = (int*)malloc((size_t)largest * sizeof(int));
+    int* work = (int*)malloc((size_t)largest * sizeof(int));
+    if (input == NULL || work == NULL) {
+        fprintf(stderr, "cannot allocate %d ints\n", largest);
+        return 1;
+    }
+
+    if (format == TABLE) {
+        printf("%-10s %-14s %11s %10s %14s %14s %14s %12s %6s\n",
+               "sort", "shape", "n", "ns/elem", "comparisons", "swaps", "moves", "peak heap", "depth");
+    } else if (format == CSV) {
+        printf("sort,shape,n,reps,ns_per_element,comparisons,swaps,moves,peak_heap_bytes,max_depth,sorted\n");
+    } else {
+        printf("{\n  \"results\": [");
+    }
+
+    int failures = 0, first = 1;
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]) && sizes[i] <= largest; i++) {
+        int n = (int)sizes[i];
+        for (int shape = 0; shape < NUM_SHAPES; shape++) {
+            fillInput(input, n, (enum Shape)shape);
+            uint64_t expected = fingerprint(input, n);
+
+            for (int s = 0; s < NUM_SORTS; s++) {
+                const struct SortEntry* entry = &sorts[s];
+                int capped = entry->quadraticOnRandom || (entry->quadraticOnOrdered && shape != RANDOM);
+                if (capped && n > QUADRATIC_CAP) continue;
+
+                struct Result result;
+                runOne(entry, (enum Shape)shape, input, work, n, expected, &result);
+                printResult(&result, format, first);
+                first = 0;
+                failures += !result.ok;
+            }
+        }
+        fflush(stdout);
+    }
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    if (format == JSON) {
+        printf("\n  ],\n  \"maxRssKiB\": %ld,\n  \"failures\": %d\n}\n", usage.ru_maxrss, failures);
+    } else if (format == TABLE) {
+        printf("\npeak RSS %ld KiB, %d unsorted result(s)\n", usage.ru_maxrss, failures);
+    }
+
+    free(input);
+    free(work);
+    return failures != 0;
+}
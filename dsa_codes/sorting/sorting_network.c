@@ -0,0 +1,643 @@
+// Sorting Networks (branch-free base case for n <= 32)
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_X86 1
+#endif
+
+#define MAX_NETWORK 32
+#define NETWORK_CUTOFF 32   // Base case size for the hybrid quick sort demo
+
+// ---------- comparator tables ----------
+//
+// Batcher's merge-exchange networks (Knuth, TAOCP 5.2.2, Algorithm M),
+// written out once so every size is a constant table. They match the
+// optimal comparator counts up to n = 8 and stay within a few percent of
+// the best known networks up to 32 (191 against 185). main() checks each
+// one with the 0-1 principle.
+
+static const unsigned char network2[1][2] = {
+    {0, 1}
+};
+static const unsigned char network3[3][2] = {
+    {0, 2}, {0, 1}, {1, 2}
+};
+static const unsigned char network4[5][2] = {
+    {0, 2}, {1, 3}, {0, 1}, {2, 3}, {1, 2}
+};
+static const unsigned char network5[9][2] = {
+    {0, 4}, {0, 2}, {1, 3}, {2, 4}, {0, 1}, {2, 3}, {1, 4}, {1, 2}, {3, 4}
+};
+static const unsigned char network6[12][2] = {
+    {0, 4}, {1, 5}, {0, 2}, {1, 3}, {2, 4}, {3, 5}, {0, 1}, {2, 3}, {4, 5}, {1, 4}, {1, 2}, {3, 4}
+};
+static const unsigned char network7[16][2] = {
+    {0, 4}, {1, 5}, {2, 6}, {0, 2}, {1, 3}, {4, 6}, {2, 4}, {3, 5}, {0, 1}, {2, 3}, {4, 5}, {1, 4},
+    {3, 6}, {1, 2}, {3, 4}, {5, 6}
+};
+static const unsigned char network8[19][2] = {
+    {0, 4}, {1, 5}, {2, 6}, {3, 7}, {0, 2}, {1, 3}, {4, 6}, {5, 7}, {2, 4}, {3, 5}, {0, 1}, {2, 3},
+    {4, 5}, {6, 7}, {1, 4}, {3, 6}, {1, 2}, {3, 4}, {5, 6}
+};
+static const unsigned char network9[26][2] = {
+    {0, 8}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {4, 8}, {0, 2}, {1, 3}, {4, 6}, {5, 7}, {2, 8}, {2, 4},
+    {3, 5}, {6, 8}, {0, 1}, {2, 3}, {4, 5}, {6, 7}, {1, 8}, {1, 4}, {3, 6}, {5, 8}, {1, 2}, {3, 4},
+    {5, 6}, {7, 8}
+};
+static const unsigned char network10[31][2] = {
+    {0, 8}, {1, 9}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {4, 8}, {5, 9}, {0, 2}, {1, 3}, {4, 6}, {5, 7},
+    {2, 8}, {3, 9}, {2, 4}, {3, 5}, {6, 8}, {7, 9}, {0, 1}, {2, 3}, {4, 5}, {6, 7}, {8, 9}, {1, 8},
+    {1, 4}, {3, 6}, {5, 8}, {1, 2}, {3, 4}, {5, 6}, {7, 8}
+};
+static const unsigned char network11[37][2] = {
+    {0, 8}, {1, 9}, {2, 10}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {4, 8}, {5, 9}, {6, 10}, {0, 2},
+    {1, 3}, {4, 6}, {5, 7}, {8, 10}, {2, 8}, {3, 9}, {2, 4}, {3, 5}, {6, 8}, {7, 9}, {0, 1}, {2, 3},
+    {4, 5}, {6, 7}, {8, 9}, {1, 8}, {3, 10}, {1, 4}, {3, 6}, {5, 8}, {7, 10}, {1, 2}, {3, 4},
+    {5, 6}, {7, 8}, {9, 10}
+};
+static const unsigned char network12[41][2] = {
+    {0, 8}, {1, 9}, {2, 10}, {3, 11}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {4, 8}, {5, 9}, {6, 10},
+    {7, 11}, {0, 2}, {1, 3}, {4, 6}, {5, 7}, {8, 10}, {9, 11}, {2, 8}, {3, 9}, {2, 4}, {3, 5},
+    {6, 8}, {7, 9}, {0, 1}, {2, 3}, {4, 5}, {6, 7}, {8, 9}, {10, 11}, {1, 8}, {3, 10}, {1, 4},
+    {3, 6}, {5, 8}, {7, 10}, {1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}
+};
+static const unsigned char network13[48][2] = {
+    {0, 8}, {1, 9}, {2, 10}, {3, 11}, {4, 12}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {8, 12}, {4, 8},
+    {5, 9}, {6, 10}, {7, 11}, {0, 2}, {1, 3}, {4, 6}, {5, 7}, {8, 10}, {9, 11}, {2, 8}, {3, 9},
+    {6, 12}, {2, 4}, {3, 5}, {6, 8}, {7, 9}, {10, 12}, {0, 1}, {2, 3}, {4, 5}, {6, 7}, {8, 9},
+    {10, 11}, {1, 8}, {3, 10}, {5, 12}, {1, 4}, {3, 6}, {5, 8}, {7, 10}, {9, 12}, {1, 2}, {3, 4},
+    {5, 6}, {7, 8}, {9, 10}, {11, 12}
+};
+static const unsigned char network14[53][2] = {
+    {0, 8}, {1, 9}, {2, 10}, {3, 11}, {4, 12}, {5, 13}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {8, 12},
+    {9, 13}, {4, 8}, {5, 9}, {6, 10}, {7, 11}, {0, 2}, {1, 3}, {4, 6}, {5, 7}, {8, 10}, {9, 11},
+    {2, 8}, {3, 9}, {6, 12}, {7, 13}, {2, 4}, {3, 5}, {6, 8}, {7, 9}, {10, 12}, {11, 13}, {0, 1},
+    {2, 3}, {4, 5}, {6, 7}, {8, 9}, {10, 11}, {12, 13}, {1, 8}, {3, 10}, {5, 12}, {1, 4}, {3, 6},
+    {5, 8}, {7, 10}, {9, 12}, {1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}, {11, 12}
+};
+static const unsigned char network15[59][2] = {
+    {0, 8}, {1, 9}, {2, 10}, {3, 11}, {4, 12}, {5, 13}, {6, 14}, {0, 4}, {1, 5}, {2, 6}, {3, 7},
+    {8, 12}, {9, 13}, {10, 14}, {4, 8}, {5, 9}, {6, 10}, {7, 11}, {0, 2}, {1, 3}, {4, 6}, {5, 7},
+    {8, 10}, {9, 11}, {12, 14}, {2, 8}, {3, 9}, {6, 12}, {7, 13}, {2, 4}, {3, 5}, {6, 8}, {7, 9},
+    {10, 12}, {11, 13}, {0, 1}, {2, 3}, {4, 5}, {6, 7}, {8, 9}, {10, 11}, {12, 13}, {1, 8}, {3, 10},
+    {5, 12}, {7, 14}, {1, 4}, {3, 6}, {5, 8}, {7, 10}, {9, 12}, {11, 14}, {1, 2}, {3, 4}, {5, 6},
+    {7, 8}, {9, 10}, {11, 12}, {13, 14}
+};
+static const unsigned char network16[63][2] = {
+    {0, 8}, {1, 9}, {2, 10}, {3, 11}, {4, 12}, {5, 13}, {6, 14}, {7, 15}, {0, 4}, {1, 5}, {2, 6},
+    {3, 7}, {8, 12}, {9, 13}, {10, 14}, {11, 15}, {4, 8}, {5, 9}, {6, 10}, {7, 11}, {0, 2}, {1, 3},
+    {4, 6}, {5, 7}, {8, 10}, {9, 11}, {12, 14}, {13, 15}, {2, 8}, {3, 9}, {6, 12}, {7, 13}, {2, 4},
+    {3, 5}, {6, 8}, {7, 9}, {10, 12}, {11, 13}, {0, 1}, {2, 3}, {4, 5}, {6, 7}, {8, 9}, {10, 11},
+    {12, 13}, {14, 15}, {1, 8}, {3, 10}, {5, 12}, {7, 14}, {1, 4}, {3, 6}, {5, 8}, {7, 10}, {9, 12},
+    {11, 14}, {1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}, {11, 12}, {13, 14}
+};
+static const unsigned char network17[74][2] = {
+    {0, 16}, {0, 8}, {1, 9}, {2, 10}, {3, 11}, {4, 12}, {5, 13}, {6, 14}, {7, 15}, {8, 16}, {0, 4},
+    {1, 5}, {2, 6}, {3, 7}, {8, 12}, {9, 13}, {10, 14}, {11, 15}, {4, 16}, {4, 8}, {5, 9}, {6, 10},
+    {7, 11}, {12, 16}, {0, 2}, {1, 3}, {4, 6}, {5, 7}, {8, 10}, {9, 11}, {12, 14}, {13, 15},
+    {2, 16}, {2, 8}, {3, 9}, {6, 12}, {7, 13}, {10, 16}, {2, 4}, {3, 5}, {6, 8}, {7, 9}, {10, 12},
+    {11, 13}, {14, 16}, {0, 1}, {2, 3}, {4, 5}, {6, 7}, {8, 9}, {10, 11}, {12, 13}, {14, 15},
+    {1, 16}, {1, 8}, {3, 10}, {5, 12}, {7, 14}, {9, 16}, {1, 4}, {3, 6}, {5, 8}, {7, 10}, {9, 12},
+    {11, 14}, {13, 16}, {1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}, {11, 12}, {13, 14}, {15, 16}
+};
+static const unsigned char network18[82][2] = {
+    {0, 16}, {1, 17}, {0, 8}, {1, 9}, {2, 10}, {3, 11}, {4, 12}, {5, 13}, {6, 14}, {7, 15}, {8, 16},
+    {9, 17}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {8, 12}, {9, 13}, {10, 14}, {11, 15}, {4, 16}, {5, 17},
+    {4, 8}, {5, 9}, {6, 10}, {7, 11}, {12, 16}, {13, 17}, {0, 2}, {1, 3}, {4, 6}, {5, 7}, {8, 10},
+    {9, 11}, {12, 14}, {13, 15}, {2, 16}, {3, 17}, {2, 8}, {3, 9}, {6, 12}, {7, 13}, {10, 16},
+    {11, 17}, {2, 4}, {3, 5}, {6, 8}, {7, 9}, {10, 12}, {11, 13}, {14, 16}, {15, 17}, {0, 1},
+    {2, 3}, {4, 5}, {6, 7}, {8, 9}, {10, 11}, {12, 13}, {14, 15}, {16, 17}, {1, 16}, {1, 8},
+    {3, 10}, {5, 12}, {7, 14}, {9, 16}, {1, 4}, {3, 6}, {5, 8}, {7, 10}, {9, 12}, {11, 14},
+    {13, 16}, {1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}, {11, 12}, {13, 14}, {15, 16}
+};
+static const unsigned char network19[91][2] = {
+    {0, 16}, {1, 17}, {2, 18}, {0, 8}, {1, 9}, {2, 10}, {3, 11}, {4, 12}, {5, 13}, {6, 14}, {7, 15},
+    {8, 16}, {9, 17}, {10, 18}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {8, 12}, {9, 13}, {10, 14},
+    {11, 15}, {4, 16}, {5, 17}, {6, 18}, {4, 8}, {5, 9}, {6, 10}, {7, 11}, {12, 16}, {13, 17},
+    {14, 18}, {0, 2}, {1, 3}, {4, 6}, {5, 7}, {8, 10}, {9, 11}, {12, 14}, {13, 15}, {16, 18},
+    {2, 16}, {3, 17}, {2, 8}, {3, 9}, {6, 12}, {7, 13}, {10, 16}, {11, 17}, {2, 4}, {3, 5}, {6, 8},
+    {7, 9}, {10, 12}, {11, 13}, {14, 16}, {15, 17}, {0, 1}, {2, 3}, {4, 5}, {6, 7}, {8, 9},
+    {10, 11}, {12, 13}, {14, 15}, {16, 17}, {1, 16}, {3, 18}, {1, 8}, {3, 10}, {5, 12}, {7, 14},
+    {9, 16}, {11, 18}, {1, 4}, {3, 6}, {5, 8}, {7, 10}, {9, 12}, {11, 14}, {13, 16}, {15, 18},
+    {1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}, {11, 12}, {13, 14}, {15, 16}, {17, 18}
+};
+static const unsigned char network20[97][2] = {
+    {0, 16}, {1, 17}, {2, 18}, {3, 19}, {0, 8}, {1, 9}, {2, 10}, {3, 11}, {4, 12}, {5, 13}, {6, 14},
+    {7, 15}, {8, 16}, {9, 17}, {10, 18}, {11, 19}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {8, 12}, {9, 13},
+    {10, 14}, {11, 15}, {4, 16}, {5, 17}, {6, 18}, {7, 19}, {4, 8}, {5, 9}, {6, 10}, {7, 11},
+    {12, 16}, {13, 17}, {14, 18}, {15, 19}, {0, 2}, {1, 3}, {4, 6}, {5, 7}, {8, 10}, {9, 11},
+    {12, 14}, {13, 15}, {16, 18}, {17, 19}, {2, 16}, {3, 17}, {2, 8}, {3, 9}, {6, 12}, {7, 13},
+    {10, 16}, {11, 17}, {2, 4}, {3, 5}, {6, 8}, {7, 9}, {10, 12}, {11, 13}, {14, 16}, {15, 17},
+    {0, 1}, {2, 3}, {4, 5}, {6, 7}, {8, 9}, {10, 11}, {12, 13}, {14, 15}, {16, 17}, {18, 19},
+    {1, 16}, {3, 18}, {1, 8}, {3, 10}, {5, 12}, {7, 14}, {9, 16}, {11, 18}, {1, 4}, {3, 6}, {5, 8},
+    {7, 10}, {9, 12}, {11, 14}, {13, 16}, {15, 18}, {1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10},
+    {11, 12}, {13, 14}, {15, 16}, {17, 18}
+};
+static const unsigned char network21[107][2] = {
+    {0, 16}, {1, 17}, {2, 18}, {3, 19}, {4, 20}, {0, 8}, {1, 9}, {2, 10}, {3, 11}, {4, 12}, {5, 13},
+    {6, 14}, {7, 15}, {8, 16}, {9, 17}, {10, 18}, {11, 19}, {12, 20}, {0, 4}, {1, 5}, {2, 6},
+    {3, 7}, {8, 12}, {9, 13}, {10, 14}, {11, 15}, {16, 20}, {4, 16}, {5, 17}, {6, 18}, {7, 19},
+    {4, 8}, {5, 9}, {6, 10}, {7, 11}, {12, 16}, {13, 17}, {14, 18}, {15, 19}, {0, 2}, {1, 3},
+    {4, 6}, {5, 7}, {8, 10}, {9, 11}, {12, 14}, {13, 15}, {16, 18}, {17, 19}, {2, 16}, {3, 17},
+    {6, 20}, {2, 8}, {3, 9}, {6, 12}, {7, 13}, {10, 16}, {11, 17}, {14, 20}, {2, 4}, {3, 5}, {6, 8},
+    {7, 9}, {10, 12}, {11, 13}, {14, 16}, {15, 17}, {18, 20}, {0, 1}, {2, 3}, {4, 5}, {6, 7},
+    {8, 9}, {10, 11}, {12, 13}, {14, 15}, {16, 17}, {18, 19}, {1, 16}, {3, 18}, {5, 20}, {1, 8},
+    {3, 10}, {5, 12}, {7, 14}, {9, 16}, {11, 18}, {13, 20}, {1, 4}, {3, 6}, {5, 8}, {7, 10},
+    {9, 12}, {11, 14}, {13, 16}, {15, 18}, {17, 20}, {1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10},
+    {11, 12}, {13, 14}, {15, 16}, {17, 18}, {19, 20}
+};
+static const unsigned char network22[114][2] = {
+    {0, 16}, {1, 17}, {2, 18}, {3, 19}, {4, 20}, {5, 21}, {0, 8}, {1, 9}, {2, 10}, {3, 11}, {4, 12},
+    {5, 13}, {6, 14}, {7, 15}, {8, 16}, {9, 17}, {10, 18}, {11, 19}, {12, 20}, {13, 21}, {0, 4},
+    {1, 5}, {2, 6}, {3, 7}, {8, 12}, {9, 13}, {10, 14}, {11, 15}, {16, 20}, {17, 21}, {4, 16},
+    {5, 17}, {6, 18}, {7, 19}, {4, 8}, {5, 9}, {6, 10}, {7, 11}, {12, 16}, {13, 17}, {14, 18},
+    {15, 19}, {0, 2}, {1, 3}, {4, 6}, {5, 7}, {8, 10}, {9, 11}, {12, 14}, {13, 15}, {16, 18},
+    {17, 19}, {2, 16}, {3, 17}, {6, 20}, {7, 21}, {2, 8}, {3, 9}, {6, 12}, {7, 13}, {10, 16},
+    {11, 17}, {14, 20}, {15, 21}, {2, 4}, {3, 5}, {6, 8}, {7, 9}, {10, 12}, {11, 13}, {14, 16},
+    {15, 17}, {18, 20}, {19, 21}, {0, 1}, {2, 3}, {4, 5}, {6, 7}, {8, 9}, {10, 11}, {12, 13},
+    {14, 15}, {16, 17}, {18, 19}, {20, 21}, {1, 16}, {3, 18}, {5, 20}, {1, 8}, {3, 10}, {5, 12},
+    {7, 14}, {9, 16}, {11, 18}, {13, 20}, {1, 4}, {3, 6}, {5, 8}, {7, 10}, {9, 12}, {11, 14},
+    {13, 16}, {15, 18}, {17, 20}, {1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}, {11, 12}, {13, 14},
+    {15, 16}, {17, 18}, {19, 20}
+};
+static const unsigned char network23[122][2] = {
+    {0, 16}, {1, 17}, {2, 18}, {3, 19}, {4, 20}, {5, 21}, {6, 22}, {0, 8}, {1, 9}, {2, 10}, {3, 11},
+    {4, 12}, {5, 13}, {6, 14}, {7, 15}, {8, 16}, {9, 17}, {10, 18}, {11, 19}, {12, 20}, {13, 21},
+    {14, 22}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {8, 12}, {9, 13}, {10, 14}, {11, 15}, {16, 20},
+    {17, 21}, {18, 22}, {4, 16}, {5, 17}, {6, 18}, {7, 19}, {4, 8}, {5, 9}, {6, 10}, {7, 11},
+    {12, 16}, {13, 17}, {14, 18}, {15, 19}, {0, 2}, {1, 3}, {4, 6}, {5, 7}, {8, 10}, {9, 11},
+    {12, 14}, {13, 15}, {16, 18}, {17, 19}, {20, 22}, {2, 16}, {3, 17}, {6, 20}, {7, 21}, {2, 8},
+    {3, 9}, {6, 12}, {7, 13}, {10, 16}, {11, 17}, {14, 20}, {15, 21}, {2, 4}, {3, 5}, {6, 8},
+    {7, 9}, {10, 12}, {11, 13}, {14, 16}, {15, 17}, {18, 20}, {19, 21}, {0, 1}, {2, 3}, {4, 5},
+    {6, 7}, {8, 9}, {10, 11}, {12, 13}, {14, 15}, {16, 17}, {18, 19}, {20, 21}, {1, 16}, {3, 18},
+    {5, 20}, {7, 22}, {1, 8}, {3, 10}, {5, 12}, {7, 14}, {9, 16}, {11, 18}, {13, 20}, {15, 22},
+    {1, 4}, {3, 6}, {5, 8}, {7, 10}, {9, 12}, {11, 14}, {13, 16}, {15, 18}, {17, 20}, {19, 22},
+    {1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}, {11, 12}, {13, 14}, {15, 16}, {17, 18}, {19, 20},
+    {21, 22}
+};
+static const unsigned char network24[127][2] = {
+    {0, 16}, {1, 17}, {2, 18}, {3, 19}, {4, 20}, {5, 21}, {6, 22}, {7, 23}, {0, 8}, {1, 9}, {2, 10},
+    {3, 11}, {4, 12}, {5, 13}, {6, 14}, {7, 15}, {8, 16}, {9, 17}, {10, 18}, {11, 19}, {12, 20},
+    {13, 21}, {14, 22}, {15, 23}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {8, 12}, {9, 13}, {10, 14},
+    {11, 15}, {16, 20}, {17, 21}, {18, 22}, {19, 23}, {4, 16}, {5, 17}, {6, 18}, {7, 19}, {4, 8},
+    {5, 9}, {6, 10}, {7, 11}, {12, 16}, {13, 17}, {14, 18}, {15, 19}, {0, 2}, {1, 3}, {4, 6},
+    {5, 7}, {8, 10}, {9, 11}, {12, 14}, {13, 15}, {16, 18}, {17, 19}, {20, 22}, {21, 23}, {2, 16},
+    {3, 17}, {6, 20}, {7, 21}, {2, 8}, {3, 9}, {6, 12}, {7, 13}, {10, 16}, {11, 17}, {14, 20},
+    {15, 21}, {2, 4}, {3, 5}, {6, 8}, {7, 9}, {10, 12}, {11, 13}, {14, 16}, {15, 17}, {18, 20},
+    {19, 21}, {0, 1}, {2, 3}, {4, 5}, {6, 7}, {8, 9}, {10, 11}, {12, 13}, {14, 15}, {16, 17},
+    {18, 19}, {20, 21}, {22, 23}, {1, 16}, {3, 18}, {5, 20}, {7, 22}, {1, 8}, {3, 10}, {5, 12},
+    {7, 14}, {9, 16}, {11, 18}, {13, 20}, {15, 22}, {1, 4}, {3, 6}, {5, 8}, {7, 10}, {9, 12},
+    {11, 14}, {13, 16}, {15, 18}, {17, 20}, {19, 22}, {1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10},
+    {11, 12}, {13, 14}, {15, 16}, {17, 18}, {19, 20}, {21, 22}
+};
+static const unsigned char network25[138][2] = {
+    {0, 16}, {1, 17}, {2, 18}, {3, 19}, {4, 20}, {5, 21}, {6, 22}, {7, 23}, {8, 24}, {0, 8}, {1, 9},
+    {2, 10}, {3, 11}, {4, 12}, {5, 13}, {6, 14}, {7, 15}, {16, 24}, {8, 16}, {9, 17}, {10, 18},
+    {11, 19}, {12, 20}, {13, 21}, {14, 22}, {15, 23}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {8, 12},
+    {9, 13}, {10, 14}, {11, 15}, {16, 20}, {17, 21}, {18, 22}, {19, 23}, {4, 16}, {5, 17}, {6, 18},
+    {7, 19}, {12, 24}, {4, 8}, {5, 9}, {6, 10}, {7, 11}, {12, 16}, {13, 17}, {14, 18}, {15, 19},
+    {20, 24}, {0, 2}, {1, 3}, {4, 6}, {5, 7}, {8, 10}, {9, 11}, {12, 14}, {13, 15}, {16, 18},
+    {17, 19}, {20, 22}, {21, 23}, {2, 16}, {3, 17}, {6, 20}, {7, 21}, {10, 24}, {2, 8}, {3, 9},
+    {6, 12}, {7, 13}, {10, 16}, {11, 17}, {14, 20}, {15, 21}, {18, 24}, {2, 4}, {3, 5}, {6, 8},
+    {7, 9}, {10, 12}, {11, 13}, {14, 16}, {15, 17}, {18, 20}, {19, 21}, {22, 24}, {0, 1}, {2, 3},
+    {4, 5}, {6, 7}, {8, 9}, {10, 11}, {12, 13}, {14, 15}, {16, 17}, {18, 19}, {20, 21}, {22, 23},
+    {1, 16}, {3, 18}, {5, 20}, {7, 22}, {9, 24}, {1, 8}, {3, 10}, {5, 12}, {7, 14}, {9, 16},
+    {11, 18}, {13, 20}, {15, 22}, {17, 24}, {1, 4}, {3, 6}, {5, 8}, {7, 10}, {9, 12}, {11, 14},
+    {13, 16}, {15, 18}, {17, 20}, {19, 22}, {21, 24}, {1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10},
+    {11, 12}, {13, 14}, {15, 16}, {17, 18}, {19, 20}, {21, 22}, {23, 24}
+};
+static const unsigned char network26[146][2] = {
+    {0, 16}, {1, 17}, {2, 18}, {3, 19}, {4, 20}, {5, 21}, {6, 22}, {7, 23}, {8, 24}, {9, 25},
+    {0, 8}, {1, 9}, {2, 10}, {3, 11}, {4, 12}, {5, 13}, {6, 14}, {7, 15}, {16, 24}, {17, 25},
+    {8, 16}, {9, 17}, {10, 18}, {11, 19}, {12, 20}, {13, 21}, {14, 22}, {15, 23}, {0, 4}, {1, 5},
+    {2, 6}, {3, 7}, {8, 12}, {9, 13}, {10, 14}, {11, 15}, {16, 20}, {17, 21}, {18, 22}, {19, 23},
+    {4, 16}, {5, 17}, {6, 18}, {7, 19}, {12, 24}, {13, 25}, {4, 8}, {5, 9}, {6, 10}, {7, 11},
+    {12, 16}, {13, 17}, {14, 18}, {15, 19}, {20, 24}, {21, 25}, {0, 2}, {1, 3}, {4, 6}, {5, 7},
+    {8, 10}, {9, 11}, {12, 14}, {13, 15}, {16, 18}, {17, 19}, {20, 22}, {21, 23}, {2, 16}, {3, 17},
+    {6, 20}, {7, 21}, {10, 24}, {11, 25}, {2, 8}, {3, 9}, {6, 12}, {7, 13}, {10, 16}, {11, 17},
+    {14, 20}, {15, 21}, {18, 24}, {19, 25}, {2, 4}, {3, 5}, {6, 8}, {7, 9}, {10, 12}, {11, 13},
+    {14, 16}, {15, 17}, {18, 20}, {19, 21}, {22, 24}, {23, 25}, {0, 1}, {2, 3}, {4, 5}, {6, 7},
+    {8, 9}, {10, 11}, {12, 13}, {14, 15}, {16, 17}, {18, 19}, {20, 21}, {22, 23}, {24, 25}, {1, 16},
+    {3, 18}, {5, 20}, {7, 22}, {9, 24}, {1, 8}, {3, 10}, {5, 12}, {7, 14}, {9, 16}, {11, 18},
+    {13, 20}, {15, 22}, {17, 24}, {1, 4}, {3, 6}, {5, 8}, {7, 10}, {9, 12}, {11, 14}, {13, 16},
+    {15, 18}, {17, 20}, {19, 22}, {21, 24}, {1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}, {11, 12},
+    {13, 14}, {15, 16}, {17, 18}, {19, 20}, {21, 22}, {23, 24}
+};
+static const unsigned char network27[155][2] = {
+    {0, 16}, {1, 17}, {2, 18}, {3, 19}, {4, 20}, {5, 21}, {6, 22}, {7, 23}, {8, 24}, {9, 25},
+    {10, 26}, {0, 8}, {1, 9}, {2, 10}, {3, 11}, {4, 12}, {5, 13}, {6, 14}, {7, 15}, {16, 24},
+    {17, 25}, {18, 26}, {8, 16}, {9, 17}, {10, 18}, {11, 19}, {12, 20}, {13, 21}, {14, 22},
+    {15, 23}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {8, 12}, {9, 13}, {10, 14}, {11, 15}, {16, 20},
+    {17, 21}, {18, 22}, {19, 23}, {4, 16}, {5, 17}, {6, 18}, {7, 19}, {12, 24}, {13, 25}, {14, 26},
+    {4, 8}, {5, 9}, {6, 10}, {7, 11}, {12, 16}, {13, 17}, {14, 18}, {15, 19}, {20, 24}, {21, 25},
+    {22, 26}, {0, 2}, {1, 3}, {4, 6}, {5, 7}, {8, 10}, {9, 11}, {12, 14}, {13, 15}, {16, 18},
+    {17, 19}, {20, 22}, {21, 23}, {24, 26}, {2, 16}, {3, 17}, {6, 20}, {7, 21}, {10, 24}, {11, 25},
+    {2, 8}, {3, 9}, {6, 12}, {7, 13}, {10, 16}, {11, 17}, {14, 20}, {15, 21}, {18, 24}, {19, 25},
+    {2, 4}, {3, 5}, {6, 8}, {7, 9}, {10, 12}, {11, 13}, {14, 16}, {15, 17}, {18, 20}, {19, 21},
+    {22, 24}, {23, 25}, {0, 1}, {2, 3}, {4, 5}, {6, 7}, {8, 9}, {10, 11}, {12, 13}, {14, 15},
+    {16, 17}, {18, 19}, {20, 21}, {22, 23}, {24, 25}, {1, 16}, {3, 18}, {5, 20}, {7, 22}, {9, 24},
+    {11, 26}, {1, 8}, {3, 10}, {5, 12}, {7, 14}, {9, 16}, {11, 18}, {13, 20}, {15, 22}, {17, 24},
+    {19, 26}, {1, 4}, {3, 6}, {5, 8}, {7, 10}, {9, 12}, {11, 14}, {13, 16}, {15, 18}, {17, 20},
+    {19, 22}, {21, 24}, {23, 26}, {1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}, {11, 12}, {13, 14},
+    {15, 16}, {17, 18}, {19, 20}, {21, 22}, {23, 24}, {25, 26}
+};
+static const unsigned char network28[161][2] = {
+    {0, 16}, {1, 17}, {2, 18}, {3, 19}, {4, 20}, {5, 21}, {6, 22}, {7, 23}, {8, 24}, {9, 25},
+    {10, 26}, {11, 27}, {0, 8}, {1, 9}, {2, 10}, {3, 11}, {4, 12}, {5, 13}, {6, 14}, {7, 15},
+    {16, 24}, {17, 25}, {18, 26}, {19, 27}, {8, 16}, {9, 17}, {10, 18}, {11, 19}, {12, 20},
+    {13, 21}, {14, 22}, {15, 23}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {8, 12}, {9, 13}, {10, 14},
+    {11, 15}, {16, 20}, {17, 21}, {18, 22}, {19, 23}, {4, 16}, {5, 17}, {6, 18}, {7, 19}, {12, 24},
+    {13, 25}, {14, 26}, {15, 27}, {4, 8}, {5, 9}, {6, 10}, {7, 11}, {12, 16}, {13, 17}, {14, 18},
+    {15, 19}, {20, 24}, {21, 25}, {22, 26}, {23, 27}, {0, 2}, {1, 3}, {4, 6}, {5, 7}, {8, 10},
+    {9, 11}, {12, 14}, {13, 15}, {16, 18}, {17, 19}, {20, 22}, {21, 23}, {24, 26}, {25, 27},
+    {2, 16}, {3, 17}, {6, 20}, {7, 21}, {10, 24}, {11, 25}, {2, 8}, {3, 9}, {6, 12}, {7, 13},
+    {10, 16}, {11, 17}, {14, 20}, {15, 21}, {18, 24}, {19, 25}, {2, 4}, {3, 5}, {6, 8}, {7, 9},
+    {10, 12}, {11, 13}, {14, 16}, {15, 17}, {18, 20}, {19, 21}, {22, 24}, {23, 25}, {0, 1}, {2, 3},
+    {4, 5}, {6, 7}, {8, 9}, {10, 11}, {12, 13}, {14, 15}, {16, 17}, {18, 19}, {20, 21}, {22, 23},
+    {24, 25}, {26, 27}, {1, 16}, {3, 18}, {5, 20}, {7, 22}, {9, 24}, {11, 26}, {1, 8}, {3, 10},
+    {5, 12}, {7, 14}, {9, 16}, {11, 18}, {13, 20}, {15, 22}, {17, 24}, {19, 26}, {1, 4}, {3, 6},
+    {5, 8}, {7, 10}, {9, 12}, {11, 14}, {13, 16}, {15, 18}, {17, 20}, {19, 22}, {21, 24}, {23, 26},
+    {1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}, {11, 12}, {13, 14}, {15, 16}, {17, 18}, {19, 20},
+    {21, 22}, {23, 24}, {25, 26}
+};
+static const unsigned char network29[171][2] = {
+    {0, 16}, {1, 17}, {2, 18}, {3, 19}, {4, 20}, {5, 21}, {6, 22}, {7, 23}, {8, 24}, {9, 25},
+    {10, 26}, {11, 27}, {12, 28}, {0, 8}, {1, 9}, {2, 10}, {3, 11}, {4, 12}, {5, 13}, {6, 14},
+    {7, 15}, {16, 24}, {17, 25}, {18, 26}, {19, 27}, {20, 28}, {8, 16}, {9, 17}, {10, 18}, {11, 19},
+    {12, 20}, {13, 21}, {14, 22}, {15, 23}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {8, 12}, {9, 13},
+    {10, 14}, {11, 15}, {16, 20}, {17, 21}, {18, 22}, {19, 23}, {24, 28}, {4, 16}, {5, 17}, {6, 18},
+    {7, 19}, {12, 24}, {13, 25}, {14, 26}, {15, 27}, {4, 8}, {5, 9}, {6, 10}, {7, 11}, {12, 16},
+    {13, 17}, {14, 18}, {15, 19}, {20, 24}, {21, 25}, {22, 26}, {23, 27}, {0, 2}, {1, 3}, {4, 6},
+    {5, 7}, {8, 10}, {9, 11}, {12, 14}, {13, 15}, {16, 18}, {17, 19}, {20, 22}, {21, 23}, {24, 26},
+    {25, 27}, {2, 16}, {3, 17}, {6, 20}, {7, 21}, {10, 24}, {11, 25}, {14, 28}, {2, 8}, {3, 9},
+    {6, 12}, {7, 13}, {10, 16}, {11, 17}, {14, 20}, {15, 21}, {18, 24}, {19, 25}, {22, 28}, {2, 4},
+    {3, 5}, {6, 8}, {7, 9}, {10, 12}, {11, 13}, {14, 16}, {15, 17}, {18, 20}, {19, 21}, {22, 24},
+    {23, 25}, {26, 28}, {0, 1}, {2, 3}, {4, 5}, {6, 7}, {8, 9}, {10, 11}, {12, 13}, {14, 15},
+    {16, 17}, {18, 19}, {20, 21}, {22, 23}, {24, 25}, {26, 27}, {1, 16}, {3, 18}, {5, 20}, {7, 22},
+    {9, 24}, {11, 26}, {13, 28}, {1, 8}, {3, 10}, {5, 12}, {7, 14}, {9, 16}, {11, 18}, {13, 20},
+    {15, 22}, {17, 24}, {19, 26}, {21, 28}, {1, 4}, {3, 6}, {5, 8}, {7, 10}, {9, 12}, {11, 14},
+    {13, 16}, {15, 18}, {17, 20}, {19, 22}, {21, 24}, {23, 26}, {25, 28}, {1, 2}, {3, 4}, {5, 6},
+    {7, 8}, {9, 10}, {11, 12}, {13, 14}, {15, 16}, {17, 18}, {19, 20}, {21, 22}, {23, 24}, {25, 26},
+    {27, 28}
+};
+static const unsigned char network30[178][2] = {
+    {0, 16}, {1, 17}, {2, 18}, {3, 19}, {4, 20}, {5, 21}, {6, 22}, {7, 23}, {8, 24}, {9, 25},
+    {10, 26}, {11, 27}, {12, 28}, {13, 29}, {0, 8}, {1, 9}, {2, 10}, {3, 11}, {4, 12}, {5, 13},
+    {6, 14}, {7, 15}, {16, 24}, {17, 25}, {18, 26}, {19, 27}, {20, 28}, {21, 29}, {8, 16}, {9, 17},
+    {10, 18}, {11, 19}, {12, 20}, {13, 21}, {14, 22}, {15, 23}, {0, 4}, {1, 5}, {2, 6}, {3, 7},
+    {8, 12}, {9, 13}, {10, 14}, {11, 15}, {16, 20}, {17, 21}, {18, 22}, {19, 23}, {24, 28},
+    {25, 29}, {4, 16}, {5, 17}, {6, 18}, {7, 19}, {12, 24}, {13, 25}, {14, 26}, {15, 27}, {4, 8},
+    {5, 9}, {6, 10}, {7, 11}, {12, 16}, {13, 17}, {14, 18}, {15, 19}, {20, 24}, {21, 25}, {22, 26},
+    {23, 27}, {0, 2}, {1, 3}, {4, 6}, {5, 7}, {8, 10}, {9, 11}, {12, 14}, {13, 15}, {16, 18},
+    {17, 19}, {20, 22}, {21, 23}, {24, 26}, {25, 27}, {2, 16}, {3, 17}, {6, 20}, {7, 21}, {10, 24},
+    {11, 25}, {14, 28}, {15, 29}, {2, 8}, {3, 9}, {6, 12}, {7, 13}, {10, 16}, {11, 17}, {14, 20},
+    {15, 21}, {18, 24}, {19, 25}, {22, 28}, {23, 29}, {2, 4}, {3, 5}, {6, 8}, {7, 9}, {10, 12},
+    {11, 13}, {14, 16}, {15, 17}, {18, 20}, {19, 21}, {22, 24}, {23, 25}, {26, 28}, {27, 29},
+    {0, 1}, {2, 3}, {4, 5}, {6, 7}, {8, 9}, {10, 11}, {12, 13}, {14, 15}, {16, 17}, {18, 19},
+    {20, 21}, {22, 23}, {24, 25}, {26, 27}, {28, 29}, {1, 16}, {3, 18}, {5, 20}, {7, 22}, {9, 24},
+    {11, 26}, {13, 28}, {1, 8}, {3, 10}, {5, 12}, {7, 14}, {9, 16}, {11, 18}, {13, 20}, {15, 22},
+    {17, 24}, {19, 26}, {21, 28}, {1, 4}, {3, 6}, {5, 8}, {7, 10}, {9, 12}, {11, 14}, {13, 16},
+    {15, 18}, {17, 20}, {19, 22}, {21, 24}, {23, 26}, {25, 28}, {1, 2}, {3, 4}, {5, 6}, {7, 8},
+    {9, 10}, {11, 12}, {13, 14}, {15, 16}, {17, 18}, {19, 20}, {21, 22}, {23, 24}, {25, 26},
+    {27, 28}
+};
+static const unsigned char network31[186][2] = {
+    {0, 16}, {1, 17}, {2, 18}, {3, 19}, {4, 20}, {5, 21}, {6, 22}, {7, 23}, {8, 24}, {9, 25},
+    {10, 26}, {11, 27}, {12, 28}, {13, 29}, {14, 30}, {0, 8}, {1, 9}, {2, 10}, {3, 11}, {4, 12},
+    {5, 13}, {6, 14}, {7, 15}, {16, 24}, {17, 25}, {18, 26}, {19, 27}, {20, 28}, {21, 29}, {22, 30},
+    {8, 16}, {9, 17}, {10, 18}, {11, 19}, {12, 20}, {13, 21}, {14, 22}, {15, 23}, {0, 4}, {1, 5},
+    {2, 6}, {3, 7}, {8, 12}, {9, 13}, {10, 14}, {11, 15}, {16, 20}, {17, 21}, {18, 22}, {19, 23},
+    {24, 28}, {25, 29}, {26, 30}, {4, 16}, {5, 17}, {6, 18}, {7, 19}, {12, 24}, {13, 25}, {14, 26},
+    {15, 27}, {4, 8}, {5, 9}, {6, 10}, {7, 11}, {12, 16}, {13, 17}, {14, 18}, {15, 19}, {20, 24},
+    {21, 25}, {22, 26}, {23, 27}, {0, 2}, {1, 3}, {4, 6}, {5, 7}, {8, 10}, {9, 11}, {12, 14},
+    {13, 15}, {16, 18}, {17, 19}, {20, 22}, {21, 23}, {24, 26}, {25, 27}, {28, 30}, {2, 16},
+    {3, 17}, {6, 20}, {7, 21}, {10, 24}, {11, 25}, {14, 28}, {15, 29}, {2, 8}, {3, 9}, {6, 12},
+    {7, 13}, {10, 16}, {11, 17}, {14, 20}, {15, 21}, {18, 24}, {19, 25}, {22, 28}, {23, 29}, {2, 4},
+    {3, 5}, {6, 8}, {7, 9}, {10, 12}, {11, 13}, {14, 16}, {15, 17}, {18, 20}, {19, 21}, {22, 24},
+    {23, 25}, {26, 28}, {27, 29}, {0, 1}, {2, 3}, {4, 5}, {6, 7}, {8, 9}, {10, 11}, {12, 13},
+    {14, 15}, {16, 17}, {18, 19}, {20, 21}, {22, 23}, {24, 25}, {26, 27}, {28, 29}, {1, 16},
+    {3, 18}, {5, 20}, {7, 22}, {9, 24}, {11, 26}, {13, 28}, {15, 30}, {1, 8}, {3, 10}, {5, 12},
+    {7, 14}, {9, 16}, {11, 18}, {13, 20}, {15, 22}, {17, 24}, {19, 26}, {21, 28}, {23, 30}, {1, 4},
+    {3, 6}, {5, 8}, {7, 10}, {9, 12}, {11, 14}, {13, 16}, {15, 18}, {17, 20}, {19, 22}, {21, 24},
+    {23, 26}, {25, 28}, {27, 30}, {1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}, {11, 12}, {13, 14},
+    {15, 16}, {17, 18}, {19, 20}, {21, 22}, {23, 24}, {25, 26}, {27, 28}, {29, 30}
+};
+static const unsigned char network32[191][2] = {
+    {0, 16}, {1, 17}, {2, 18}, {3, 19}, {4, 20}, {5, 21}, {6, 22}, {7, 23}, {8, 24}, {9, 25},
+    {10, 26}, {11, 27}, {12, 28}, {13, 29}, {14, 30}, {15, 31}, {0, 8}, {1, 9}, {2, 10}, {3, 11},
+    {4, 12}, {5, 13}, {6, 14}, {7, 15}, {16, 24}, {17, 25}, {18, 26}, {19, 27}, {20, 28}, {21, 29},
+    {22, 30}, {23, 31}, {8, 16}, {9, 17}, {10, 18}, {11, 19}, {12, 20}, {13, 21}, {14, 22},
+    {15, 23}, {0, 4}, {1, 5}, {2, 6}, {3, 7}, {8, 12}, {9, 13}, {10, 14}, {11, 15}, {16, 20},
+    {17, 21}, {18, 22}, {19, 23}, {24, 28}, {25, 29}, {26, 30}, {27, 31}, {4, 16}, {5, 17}, {6, 18},
+    {7, 19}, {12, 24}, {13, 25}, {14, 26}, {15, 27}, {4, 8}, {5, 9}, {6, 10}, {7, 11}, {12, 16},
+    {13, 17}, {14, 18}, {15, 19}, {20, 24}, {21, 25}, {22, 26}, {23, 27}, {0, 2}, {1, 3}, {4, 6},
+    {5, 7}, {8, 10}, {9, 11}, {12, 14}, {13, 15}, {16, 18}, {17, 19}, {20, 22}, {21, 23}, {24, 26},
+    {25, 27}, {28, 30}, {29, 31}, {2, 16}, {3, 17}, {6, 20}, {7, 21}, {10, 24}, {11, 25}, {14, 28},
+    {15, 29}, {2, 8}, {3, 9}, {6, 12}, {7, 13}, {10, 16}, {11, 17}, {14, 20}, {15, 21}, {18, 24},
+    {19, 25}, {22, 28}, {23, 29}, {2, 4}, {3, 5}, {6, 8}, {7, 9}, {10, 12}, {11, 13}, {14, 16},
+    {15, 17}, {18, 20}, {19, 21}, {22, 24}, {23, 25}, {26, 28}, {27, 29}, {0, 1}, {2, 3}, {4, 5},
+    {6, 7}, {8, 9}, {10, 11}, {12, 13}, {14, 15}, {16, 17}, {18, 19}, {20, 21}, {22, 23}, {24, 25},
+    {26, 27}, {28, 29}, {30, 31}, {1, 16}, {3, 18}, {5, 20}, {7, 22}, {9, 24}, {11, 26}, {13, 28},
+    {15, 30}, {1, 8}, {3, 10}, {5, 12}, {7, 14}, {9, 16}, {11, 18}, {13, 20}, {15, 22}, {17, 24},
+    {19, 26}, {21, 28}, {23, 30}, {1, 4}, {3, 6}, {5, 8}, {7, 10}, {9, 12}, {11, 14}, {13, 16},
+    {15, 18}, {17, 20}, {19, 22}, {21, 24}, {23, 26}, {25, 28}, {27, 30}, {1, 2}, {3, 4}, {5, 6},
+    {7, 8}, {9, 10}, {11, 12}, {13, 14}, {15, 16}, {17, 18}, {19, 20}, {21, 22}, {23, 24}, {25, 26},
+    {27, 28}, {29, 30}
+};
+
+// ---------- scalar networks ----------
+
+// Compiles to two cmovs: no branch to mispredict
+static inline __attribute__((always_inline)) void compareSwap(int v[], int i, int j) {
+    int x = v[i], y = v[j];
+    v[i] = x < y ? x : y;
+    v[j] = x < y ? y : x;
+}
+
+// The table is constant and the loop fully unrolled, so each network
+// becomes straight-line code on a local copy the compiler keeps in registers
+#define DEFINE_NETWORK(N)                                                   \
+    static void sortNetwork##N(int arr[]) {                                 \
+        int v[N];                                                           \
+        memcpy(v, arr, sizeof(v));                                          \
+        _Pragma("GCC unroll 256")                                           \
+        for (int k = 0; k < (int)(sizeof(network##N) / sizeof(network##N[0])); k++) { \
+            compareSwap(v, network##N[k][0], network##N[k][1]);             \
+        }                                                                   \
+        memcpy(arr, v, sizeof(v));                                          \
+    }
+
+DEFINE_NETWORK(2)  DEFINE_NETWORK(3)  DEFINE_NETWORK(4)  DEFINE_NETWORK(5)
+DEFINE_NETWORK(6)  DEFINE_NETWORK(7)  DEFINE_NETWORK(8)  DEFINE_NETWORK(9)
+DEFINE_NETWORK(10) DEFINE_NETWORK(11) DEFINE_NETWORK(12) DEFINE_NETWORK(13)
+DEFINE_NETWORK(14) DEFINE_NETWORK(15) DEFINE_NETWORK(16) DEFINE_NETWORK(17)
+DEFINE_NETWORK(18) DEFINE_NETWORK(19) DEFINE_NETWORK(20) DEFINE_NETWORK(21)
+DEFINE_NETWORK(22) DEFINE_NETWORK(23) DEFINE_NETWORK(24) DEFINE_NETWORK(25)
+DEFINE_NETWORK(26) DEFINE_NETWORK(27) DEFINE_NETWORK(28) DEFINE_NETWORK(29)
+DEFINE_NETWORK(30) DEFINE_NETWORK(31) DEFINE_NETWORK(32)
+
+typedef void (*NetworkFn)(int arr[]);
+
+static NetworkFn networks[MAX_NETWORK + 1] = {
+    NULL, NULL, sortNetwork2, sortNetwork3, sortNetwork4, sortNetwork5,
+    sortNetwork6, sortNetwork7, sortNetwork8, sortNetwork9, sortNetwork10,
+    sortNetwork11, sortNetwork12, sortNetwork13, sortNetwork14, sortNetwork15,
+    sortNetwork16, sortNetwork17, sortNetwork18, sortNetwork19, sortNetwork20,
+    sortNetwork21, sortNetwork22, sortNetwork23, sortNetwork24, sortNetwork25,
+    sortNetwork26, sortNetwork27, sortNetwork28, sortNetwork29, sortNetwork30,
+    sortNetwork31, sortNetwork32
+};
+
+// ---------- SIMD networks ----------
+
+#ifdef HAVE_X86
+
+// One bitonic step: every lane meets its partner, and the blend mask picks
+// which lanes keep the max
+#define BITONIC_STEP(v, partner, maxLanes)                                      \
+    do {                                                                        \
+        __m256i p_ = (partner);                                                 \
+        v = _mm256_blend_epi32(_mm256_min_epi32(v, p_), _mm256_max_epi32(v, p_), maxLanes); \
+    } while (0)
+
+#define SWAP_PAIRS(v)   _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1))   // lane i ^ 1
+#define SWAP_QUADS(v)   _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2))   // lane i ^ 2
+#define SWAP_HALVES(v)  _mm256_permute2x128_si256(v, v, 0x01)              // lane i ^ 4
+
+// Sorts a bitonic vector ascending
+__attribute__((target("avx2")))
+static inline __m256i bitonicMerge8(__m256i v) {
+    BITONIC_STEP(v, SWAP_HALVES(v), 0xF0);
+    BITONIC_STEP(v, SWAP_QUADS(v), 0xCC);
+    BITONIC_STEP(v, SWAP_PAIRS(v), 0xAA);
+    return v;
+}
+
+// Bitonic sort of one register: 6 min/max steps on 8 lanes at once
+__attribute__((target("avx2")))
+static inline __m256i sortVector8(__m256i v) {
+    BITONIC_STEP(v, SWAP_PAIRS(v), 0x66);
+    BITONIC_STEP(v, SWAP_QUADS(v), 0x3C);
+    BITONIC_STEP(v, SWAP_PAIRS(v), 0x5A);
+    return bitonicMerge8(v);
+}
+
+__attribute__((target("avx2")))
+static void sortNetwork8Avx2(int arr[]) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)arr);
+    _mm256_storeu_si256((__m256i*)arr, sortVector8(v));
+}
+
+// Two sorted registers, one reversed, form a bitonic sequence: one
+// min/max splits it into halves that each finish with bitonicMerge8
+__attribute__((target("avx2")))
+static void sortNetwork16Avx2(int arr[]) {
+    __m256i a = sortVector8(_mm256_loadu_si256((const __m256i*)arr));
+    __m256i b = sortVector8(_mm256_loadu_si256((const __m256i*)(arr + 8)));
+    b = _mm256_permutevar8x32_epi32(b, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+    __m256i lo = _mm256_min_epi32(a, b);
+    __m256i hi = _mm256_max_epi32(a, b);
+    _mm256_storeu_si256((__m256i*)arr, bitonicMerge8(lo));
+    _mm256_storeu_si256((__m256i*)(arr + 8), bitonicMerge8(hi));
+}
+
+#endif
+
+// Swaps in the AVX2 networks for 8 and 16 when the CPU has them
+void initSortingNetworks() {
+#ifdef HAVE_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        networks[8] = sortNetwork8Avx2;
+        networks[16] = sortNetwork16Avx2;
+    }
+#endif
+}
+
+void insertionSort(int arr[], int n) {
+    for (int i = 1; i < n; i++) {
+        int key = arr[i];
+        int j = i - 1;
+
+        while (j >= 0 && arr[j] > key) {
+            arr[j + 1] = arr[j];
+            j--;
+        }
+        arr[j + 1] = key;
+    }
+}
+
+// Same (arr, n) shape as insertionSort, so it drops into any base case
+void networkSort(int arr[], int n) {
+    if (n < 2) return;
+    if (n <= MAX_NETWORK) networks[n](arr);
+    else insertionSort(arr, n);
+}
+
+// ---------- hybrid quick sort, to show the base case in use ----------
+
+static int medianOf3(int a, int b, int c) {
+    if (a < b) return b < c ? b : (a < c ? c : a);
+    return a < c ? a : (b < c ? c : b);
+}
+
+// Hoare partition around a median-of-3 value; small ranges go to baseCase
+static void quickSortWithBase(int arr[], int low, int high, void (*baseCase)(int[], int)) {
+    while (high - low + 1 > NETWORK_CUTOFF) {
+        int pivot = medianOf3(arr[low], arr[low + (high - low) / 2], arr[high]);
+        int i = low - 1, j = high + 1;
+        for (;;) {
+            do i++; while (arr[i] < pivot);
+            do j--; while (arr[j] > pivot);
+            if (i >= j) break;
+            int temp = arr[i];
+            arr[i] = arr[j];
+            arr[j] = temp;
+        }
+        if (j - low < high - j) {
+            quickSortWithBase(arr, low, j, baseCase);
+            low = j + 1;
+        } else {
+            quickSortWithBase(arr, j + 1, high, baseCase);
+            high = j;
+        }
+    }
+    baseCase(arr + low, high - low + 1);
+}
+
+void display(int arr[], int n) {
+    for (int i = 0; i < n; i++) {
+        printf("%d ", arr[i]);
+    }
+    printf("\n");
+}
+
+// ---------- verification and benchmark ----------
+
+static double nowSeconds() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t nextRandom(uint32_t* state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+static int isSorted(const int arr[], int n) {
+    for (int i = 1; i < n; i++) {
+        if (arr[i - 1] > arr[i]) return 0;
+    }
+    return 1;
+}
+
+// 0-1 principle: a network sorting every 0/1 input sorts everything.
+// Exhaustive up to 20 wires, random 0/1 and full-range inputs beyond.
+static int verifyNetwork(NetworkFn sort, int n) {
+    int a[MAX_NETWORK], b[MAX_NETWORK];
+    uint32_t state = 2463534242u;
+    long cases = n <= 20 ? 1L << n : 1L << 20;
+
+    for (long c = 0; c < cases; c++) {
+        uint32_t bits = n <= 20 ? (uint32_t)c : nextRandom(&state);
+        for (int i = 0; i < n; i++) a[i] = (bits >> i) & 1;
+        sort(a);
+        if (!isSorted(a, n)) return 0;
+    }
+    for (int c = 0; c < 10000; c++) {
+        for (int i = 0; i < n; i++) a[i] = b[i] = (int)nextRandom(&state);
+        sort(a);
+        insertionSort(b, n);
+        if (memcmp(a, b, n * sizeof(int)) != 0) return 0;
+    }
+    return 1;
+}
+
+// Sorts every consecutive n-int chunk of data; returns ns per chunk
+static double timeChunks(void (*sort)(int[], int), const int source[], int data[], int total, int n) {
+    int chunks = total / n;
+    memcpy(data, source, (size_t)total * sizeof(int));
+    double start = nowSeconds();
+    for (int c = 0; c < chunks; c++) sort(data + (size_t)c * n, n);
+    return (nowSeconds() - start) * 1e9 / chunks;
+}
+
+static void scalarNetworkSort(int arr[], int n) {
+    static NetworkFn scalar[] = { [8] = sortNetwork8, [16] = sortNetwork16 };
+    scalar[n](arr);
+}
+
+int main(int argc, char* argv[]) {
+    int arr[] = {64, 34, 25, 12, 22, 11, 90, 5};
+    int n = sizeof(arr) / sizeof(arr[0]);
+
+    initSortingNetworks();
+
+    printf("Original array: ");
+    display(arr, n);
+
+    networkSort(arr, n);
+
+    printf("Sorted array: ");
+    display(arr, n);
+
+    int failures = 0;
+    for (int size = 2; size <= MAX_NETWORK; size++) {
+        if (!verifyNetwork(networks[size], size)) {
+            printf("network %d FAILED verification\n", size);
+            failures++;
+        }
+    }
+#ifdef HAVE_X86
+    if (networks[8] != sortNetwork8) {
+        failures += !verifyNetwork(sortNetwork8, 8);
+        failures += !verifyNetwork(sortNetwork16, 16);
+    }
+#endif
+    printf("\nAll networks 2..%d verified: %s\n", MAX_NETWORK, failures ? "NO" : "yes");
+
+    const int total = 1 << 20;
+    int* source = (int*)malloc(total * sizeof(int));
+    int* data = (int*)malloc(total * sizeof(int));
+    uint32_t state = 12345;
+    for (int i = 0; i < total; i++) source[i] = (int)nextRandom(&state);
+
+    printf("\nns per sort of n random ints\n%4s %12s %12s %8s\n", "n", "insertion", "network", "speedup");
+    for (int size = 2; size <= MAX_NETWORK; size++) {
+        double ins = timeChunks(insertionSort, source, data, total, size);
+        double net = timeChunks(networkSort, source, data, total, size);
+        printf("%4d %12.1f %12.1f %7.2fx\n", size, ins, net, ins / net);
+        if ((size == 8 || size == 16) && networks[size] != (size == 8 ? sortNetwork8 : sortNetwork16)) {
+            double scalar = timeChunks(scalarNetworkSort, source, data, total, size);
+            printf("%4s %12s %12.1f   (scalar network; row above is AVX2)\n", "", "", scalar);
+        }
+    }
+
+    // Quick sort whose ranges of <= 32 finish with each base case
+    int size = argc > 1 ? atoi(argv[1]) : 10000000;
+    int* big = (int*)malloc((size_t)size * sizeof(int));
+    void (*bases[])(int[], int) = { insertionSort, networkSort };
+    const char* baseNames[] = { "insertionSort", "networkSort" };
+    printf("\nquick sort of %d ints, ranges <= %d go to the base case\n", size, NETWORK_CUTOFF);
+    for (int b = 0; b < 2; b++) {
+        state = 777;
+        for (int i = 0; i < size; i++) big[i] = (int)nextRandom(&state);
+        double start = nowSeconds();
+        quickSortWithBase(big, 0, size - 1, bases[b]);
+        double ms = (nowSeconds() - start) * 1e3;
+        printf("%-14s %8.1f ms%s\n", baseNames[b], ms, isSorted(big, size) ? "" : " UNSORTED");
+    }
+
+    free(source);
+    free(data);
+    free(big);
+    return failures != 0;
+}
@@ -357,6 +357,146 @@ export const algorithmExplanations: Record<string, AlgorithmExplanation> = {
         useCase: 'General purpose sorting, when average case is acceptable, cache-friendly',
         visualization: { type: 'sorting', interactive: true }
     },
+    'intro_sort': {
+        title: 'Introsort',
+        description: 'Quick sort hardened for production: good pivots, 3-way partitioning, bounded recursion and a heapsort fallback.',
+        timeComplexity: { best: 'O(n)', average: 'O(n log n)', worst: 'O(n log n)' },
+        spaceComplexity: 'O(log n)',
+        howItWorks: [
+            '1. Pick the pivot by median-of-3, or ninther on large ranges',
+            '2. Dutch flag partition splits the range into <, == and > pivot',
+            '3. Recurse into the smaller side and loop on the larger one',
+            '4. Ranges of 16 or fewer elements finish with insertion sort',
+            '5. After 2·log2(n) levels, switch to heapsort for the range'
+        ],
+        useCase: 'General-purpose in-place sorting where sorted or duplicate-heavy input must not go quadratic'
+    },
+    'parallel_merge_sort': {
+        title: 'Parallel Merge Sort',
+        description: 'Stable merge sort that forks recursive halves onto a thread pool and splits large merges by co-rank.',
+        timeComplexity: { best: 'O(n log n)', average: 'O(n log n)', worst: 'O(n log n)' },
+        spaceComplexity: 'O(n)',
+        howItWorks: [
+            '1. Allocate one scratch buffer the size of the input',
+            '2. Sort each half into the opposite buffer, then merge back (ping-pong)',
+            '3. Large halves run as pool tasks; waiting threads help run queued tasks',
+            '4. Large merges split the output into chunks, one per task',
+            '5. Each chunk finds its input split by binary-searching the co-rank',
+            '6. Ties always take the left element first, keeping the sort stable'
+        ],
+        useCase: 'Sorting very large arrays on multi-core machines when stability matters'
+    },
+    'radix_sort': {
+        title: 'LSD Radix Sort',
+        description: 'Non-comparison sort that orders integers one 8-bit digit at a time, least significant first.',
+        timeComplexity: { best: 'O(n)', average: 'O(w/8 · n)', worst: 'O(w/8 · n)' },
+        spaceComplexity: 'O(n)',
+        howItWorks: [
+            '1. One pass over the input counts the digits for every pass at once',
+            '2. Passes where every key has the same digit are skipped',
+            '3. Each pass prefix-sums its histogram and scatters keys stably into a buffer',
+            '4. The sign bit is flipped when extracting digits so negatives sort first',
+            '5. The parallel variant counts and scatters per-thread slices'
+        ],
+        useCase: 'Large arrays of 32/64-bit integer keys where comparison sorts are too slow'
+    },
+    'external_merge_sort': {
+        title: 'External Merge Sort',
+        description: 'Sorts binary int files larger than memory by spilling sorted runs to disk and merging them with a loser tree.',
+        timeComplexity: { best: 'O(n log n)', average: 'O(n log n)', worst: 'O(n log n)' },
+        spaceComplexity: 'O(memory budget) RAM, O(n) disk',
+        howItWorks: [
+            '1. Read as many ints as half the memory budget allows',
+            '2. Radix-sort the run in memory and spill it to a temp file',
+            '3. Merge up to the fan-in that fits the budget with a loser tree',
+            '4. Each run reads into two buffers with async I/O, consuming one while the other fills',
+            '5. Output is double-buffered the same way; extra passes run until one file remains'
+        ],
+        useCase: 'Nightly batch jobs sorting hundreds of gigabytes on a machine with far less RAM'
+    },
+    'simd_quick_sort': {
+        title: 'SIMD Quick Sort',
+        description: 'Quick sort whose partition step compares 8 (AVX2) or 16 (AVX-512) elements against the pivot at once, picked at runtime.',
+        timeComplexity: { best: 'O(n log n)', average: 'O(n log n)', worst: 'O(n log n)' },
+        spaceComplexity: 'O(log n)',
+        howItWorks: [
+            '1. At startup, check the CPU and pick the AVX-512, AVX2 or scalar partition kernel',
+            '2. Set the first and last vectors aside to open a gap at both ends',
+            '3. Load a vector from the side with less room and compare all lanes to the pivot',
+            '4. Compress-store the smaller lanes to the left gap and the rest to the right gap',
+            '5. Recurse on the smaller side; fall back to heap sort if the depth limit is hit'
+        ],
+        useCase: 'Sorting large arrays of plain integers where branch mispredictions dominate the scalar partition'
+    },
+    'sort_benchmark': {
+        title: 'Sorting Benchmark Suite',
+        description: 'Runs the repository\'s own sorts and libc qsort across input shapes and sizes, reporting time, comparisons, swaps, moves, scratch memory and recursion depth.',
+        timeComplexity: { best: 'O(n log n)', average: 'O(n²) for the quadratic sorts', worst: 'O(n²), capped at 4096 elements' },
+        spaceComplexity: 'O(n)',
+        howItWorks: [
+            '1. Include bubble, selection, insertion, merge and quick sort from their own files, with their demo mains compiled out',
+            '2. Redefine their comparison, swap, move and recursion hooks to update counters',
+            '3. Generate random, sorted, reverse, few-unique, organ-pipe and nearly-sorted inputs from 16 up to 10^9 elements',
+            '4. Repeat small sizes until a million elements are sorted, and cap quadratic cases at 4096',
+            '5. Check every result for order and for a fingerprint of the input, then print a table, CSV or JSON'
+        ],
+        useCase: 'Tracking regressions in the sorts and comparing them on the shapes real data takes'
+    },
+    'sorting_network': {
+        title: 'Sorting Networks',
+        description: 'Fixed sequences of compare-exchange steps that sort 2 to 32 elements with no data-dependent branches.',
+        timeComplexity: { best: 'O(n log² n)', average: 'O(n log² n)', worst: 'O(n log² n)' },
+        spaceComplexity: 'O(1)',
+        howItWorks: [
+            '1. Each size n has a constant table of index pairs (Batcher merge exchange)',
+            '2. Every pair is compared and swapped with min/max, compiled to conditional moves',
+            '3. The loop over the table is fully unrolled into straight-line code',
+            '4. Sizes 8 and 16 run as bitonic networks inside AVX2 registers when available',
+            '5. networkSort(arr, n) picks the network by size, so quick or merge sort can use it as the base case'
+        ],
+        useCase: 'Base case of quick sort and merge sort, where tiny random subarrays make insertion sort mispredict'
+    },
+    'parallel_sample_sort': {
+        title: 'Parallel Sample Sort',
+        description: 'Splits the array into 256 buckets using splitters drawn from a random sample, moves whole blocks into place, then sorts the buckets in parallel.',
+        timeComplexity: { best: 'O(n)', average: 'O(n log n / p)', worst: 'O(n log n)' },
+        spaceComplexity: 'O(p · buckets · block)',
+        howItWorks: [
+            '1. Sort a random sample and take every 16th key as a splitter',
+            '2. Each thread classifies its stripe with a branchless splitter tree into per-bucket buffer blocks',
+            '3. Full blocks are written back over the stripe, so no second array is needed',
+            '4. Threads swap blocks into their bucket regions, claiming slots under per-bucket locks',
+            '5. Fix up the bucket edges, then sort each bucket with introsort in parallel; buckets of equal keys are skipped'
+        ],
+        useCase: 'Sorting hundreds of millions of keys on many-core servers with little synchronization'
+    },
+    'quick_select': {
+        title: 'Quickselect',
+        description: 'Finds the k-th smallest element, several order statistics at once, or the sorted top k, without sorting the whole array.',
+        timeComplexity: { best: 'O(n)', average: 'O(n)', worst: 'O(n)' },
+        spaceComplexity: 'O(log n)',
+        howItWorks: [
+            '1. Partition around a median-of-3 pivot, reusing the quick sort partition',
+            '2. Continue only into the side that holds the target position',
+            '3. For several targets, split them between the sides and follow both',
+            '4. If two steps fail to halve the range, switch to a median-of-medians pivot to guarantee O(n)',
+            '5. Partial sort selects the k-th element, then heap-sorts the first k'
+        ],
+        useCase: 'Medians, percentiles for latency dashboards, and top-k queries over large arrays'
+    },
+    'argsort': {
+        title: 'Argsort (Key-Index Sort)',
+        description: 'Sorts large records by an integer key by sorting compact (key, index) words, then moving each record once.',
+        timeComplexity: { best: 'O(n)', average: 'O(n log n)', worst: 'O(n log n)' },
+        spaceComplexity: 'O(n) words, O(1) records',
+        howItWorks: [
+            '1. Pack each record\'s key and index into one 64-bit word, key in the high half',
+            '2. Sort the words with radix, quick or merge sort; ties fall back to index order, so all paths are stable',
+            '3. The low halves of the sorted words are the permutation (argsort stops here)',
+            '4. Apply it in place by following each cycle with one record of scratch space'
+        ],
+        useCase: 'Sorting arrays of 64–256 byte structs, or producing a sort order for parallel columns'
+    },
 
 
     // ==================== SEARCHING ====================
@@ -376,6 +516,21 @@ export const algorithmExplanations: Record<string, AlgorithmExplanation> = {
         useCase: 'Small datasets, unsorted data, one-time searches',
         visualization: { type: 'array', interactive: true }
     },
+    'simd_linear_search': {
+        title: 'SIMD Linear Search',
+        description: 'Linear search that compares 16–32 ints per loop iteration with SSE4.1 or AVX2, with variants for several needles, counting, and match bitmaps or index lists.',
+        timeComplexity: { best: 'O(1)', average: 'O(n / w)', worst: 'O(n / w)' },
+        spaceComplexity: 'O(1)',
+        howItWorks: [
+            '1. Broadcast the key into every lane of a vector register',
+            '2. Load four vectors, compare each lane for equality, and OR the results',
+            '3. A single test of the OR decides whether to stop; only then is the first matching lane located',
+            '4. Several needles are handled by OR-ing one compare per needle in the same pass',
+            '5. Counting subtracts the all-ones compare masks, and bitmaps pack the movemask bits 32 elements per word',
+            '6. The widest kernel set the CPU supports is chosen at startup, with a scalar fallback'
+        ],
+        useCase: 'Small to medium unsorted arrays, filters and membership tests where sorting or indexing does not pay off'
+    },
     'binary_search': {
         title: 'Binary Search',
         description: 'Efficient search on sorted array by repeatedly dividing search interval in half.',
@@ -392,6 +547,77 @@ export const algorithmExplanations: Record<string, AlgorithmExplanation> = {
         useCase: 'Large sorted datasets, dictionaries, database indexing',
         visualization: { type: 'array', interactive: true }
     },
+    'eytzinger_search': {
+        title: 'Eytzinger Search',
+        description: 'Binary search over keys stored in BFS (heap) order, with a branchless loop that prefetches four levels ahead.',
+        timeComplexity: { best: 'O(log n)', average: 'O(log n)', worst: 'O(log n)' },
+        spaceComplexity: 'O(n) for the re-laid-out copy',
+        howItWorks: [
+            '1. Once, copy the sorted array into tree order: root at 1, children of k at 2k and 2k+1',
+            '2. Descend with k = 2k + (keys[k] < key), which compiles to no data-dependent branch',
+            '3. Each step prefetches index 16k, the cache line holding all 16 descendants four levels down',
+            '4. Undo the trailing right turns (k >> ffs(~k)) to get the lower bound',
+            '5. Arrays that cannot be re-laid out use a branchless lower_bound on the sorted order instead'
+        ],
+        useCase: 'Read-heavy lookups in large static sorted arrays, such as IP range or ID tables'
+    },
+    'batched_binary_search': {
+        title: 'Batched Binary Search',
+        description: 'Searches many keys in one sorted array at once, overlapping their cache misses instead of paying for them one by one.',
+        timeComplexity: { best: 'O(k log n)', average: 'O(k log n)', worst: 'O(k log n)' },
+        spaceComplexity: 'O(batch)',
+        howItWorks: [
+            '1. Take a group of 16–32 keys and start each search window at the whole array',
+            '2. The branchless search halves every window by the same amount, so all keys stay in lockstep',
+            '3. At each step, probe every key and prefetch its next midpoint before moving on',
+            '4. The memory system serves all the misses of a step in parallel',
+            '5. For ascending keys, gallop forward from the previous answer instead of restarting'
+        ],
+        useCase: 'Millions of membership checks or joins against one large sorted column'
+    },
+    's_tree_search': {
+        title: 'Static S-tree Search',
+        description: 'A pointer-free B+-tree over a read-only sorted set: each node is one cache line of 16 keys, searched with two SIMD compares.',
+        timeComplexity: { best: 'O(log₁₇ n)', average: 'O(log₁₇ n)', worst: 'O(log₁₇ n)' },
+        spaceComplexity: 'O(n)',
+        howItWorks: [
+            '1. The leaf layer is the sorted keys in nodes of 16, padded with the maximum value',
+            '2. Each layer above holds, for every group of 17 children, the smallest key of children 2 to 17; child i of node k is node 17k+i of the next layer, so no pointers are stored',
+            '3. At each node, compare the query against all 16 keys at once and count the smaller ones',
+            '4. That count picks the child to descend into; in the leaf, node * 16 + count is the sorted index',
+            '5. Optionally back the nodes with 2 MB huge pages to cut TLB misses'
+        ],
+        useCase: 'Repeated lookups in large static sorted sets, such as read-only indexes and dictionaries'
+    },
+    'learned_index_search': {
+        title: 'Learned Index (Piecewise-Linear)',
+        description: 'Generalizes interpolation search: a sequence of fitted line segments predicts where a key is, with a guaranteed maximum error ε, and a short search fixes the last few positions.',
+        timeComplexity: { best: 'O(1)', average: 'O(log ε · levels)', worst: 'O(log n)' },
+        spaceComplexity: 'O(n / ε) segments',
+        howItWorks: [
+            '1. Walk the sorted keys once, growing a line segment while every key stays within ε positions of it',
+            '2. When no line fits, start a new segment; skewed or clustered data simply gets more segments',
+            '3. Fit the same kind of model over the segments\' first keys, level by level, up to one root segment',
+            '4. To look up x, each level predicts the segment below, and a search over 2ε+2 entries corrects it',
+            '5. The bottom segment predicts the position in the array, and a last-mile binary search over ±ε finishes'
+        ],
+        useCase: 'Large read-only sorted key sets where a model far smaller than a B-tree is wanted, on any key distribution'
+    },
+    'adaptive_search': {
+        title: 'Adaptive Search Dispatcher',
+        description: 'Profiles a sorted array once and picks the search algorithm that suits it, optionally confirming the pick with a short timing run.',
+        timeComplexity: { best: 'O(1)', average: 'O(log n)', worst: 'O(log n)' },
+        spaceComplexity: 'O(1), or O(n) when the Eytzinger index is chosen',
+        howItWorks: [
+            '1. Measure the array size against the L2 cache',
+            '2. Sample keys to see how far a single straight line (interpolation\'s assumption) is from their positions',
+            '3. Sample neighbouring keys to estimate how many duplicates there are',
+            '4. A rule of thumb picks linear, interpolation, an Eytzinger index or branchless binary search',
+            '5. Optionally time every candidate on sample queries under a small budget and keep the fastest',
+            '6. Every lookup then goes through the chosen strategy; the choice and the measured costs can be logged'
+        ],
+        useCase: 'Libraries and services that search many different sorted arrays and cannot hand-tune each one'
+    },
     'jump_search': {
         title: 'Jump Search',
         description: 'Searching in sorted arrays by jumping ahead by fixed steps.',
@@ -612,6 +838,134 @@ export const algorithmExplanations: Record<string, AlgorithmExplanation> = {
         ],
         useCase: 'Dictionaries, caches, symbol tables, database indexing',
         visualization: { type: 'hash', interactive: true }
+    },
+    'open_addressing_hash_table': {
+        title: 'Open Addressing Hash Table (Robin Hood)',
+        description: 'Growable flat hash table that stores entries in one array and balances probe lengths with Robin Hood hashing.',
+        timeComplexity: { best: 'O(1)', average: 'O(1)', worst: 'O(n)' },
+        spaceComplexity: 'O(n)',
+        howItWorks: [
+            '1. Fibonacci hashing maps a key to its home slot',
+            '2. A control byte per slot stores the probe distance (0 = empty)',
+            '3. Insert: an entry far from home steals the slot of one closer to home',
+            '4. Search: SIMD compares 16 control bytes at once, stopping at the first shorter distance',
+            '5. Delete: following entries shift back one slot, so no tombstones remain',
+            '6. The table doubles once it is 7/8 full'
+        ],
+        useCase: 'High-throughput key-value lookups where pointer chasing and per-insert malloc are too slow'
+    },
+    'hash_table_slab': {
+        title: 'Hash Table with Slab Allocator',
+        description: 'Chaining hash table whose nodes come from a pluggable allocator backed by slab pages and a freelist.',
+        timeComplexity: { best: 'O(1)', average: 'O(1)', worst: 'O(n)' },
+        spaceComplexity: 'O(n)',
+        howItWorks: [
+            '1. Nodes are carved out of 1024-node slab pages, one malloc per page',
+            '2. Deleted nodes go onto a freelist and are reused by later inserts',
+            '3. Delete unlinks the node through a pointer-to-pointer walk',
+            '4. Destroying the table frees whole slabs without walking the chains',
+            '5. Counters track malloc/free calls and live nodes'
+        ],
+        useCase: 'Insert-heavy tables where per-node malloc and scattered nodes dominate the cost'
+    },
+    'concurrent_hash_table': {
+        title: 'Concurrent Hash Table',
+        description: 'Thread-safe chaining hash table with lock-free searches, striped writer locks and epoch-based node reclamation.',
+        timeComplexity: { best: 'O(1)', average: 'O(1)', worst: 'O(n)' },
+        spaceComplexity: 'O(n)',
+        howItWorks: [
+            '1. Search walks the chain with atomic loads and never takes a lock',
+            '2. Insert and delete lock one of 64 stripes covering the bucket',
+            '3. A new node is fully built before it is published at the chain head',
+            '4. Deleted nodes are retired to a per-thread limbo list',
+            '5. A retired node is freed once the global epoch has advanced twice'
+        ],
+        useCase: 'Shared lookup tables in multi-threaded servers with read-heavy workloads'
+    },
+    'incremental_rehash_hash_table': {
+        title: 'Incremental Rehashing',
+        description: 'Chaining hash table that grows by migrating a few buckets per operation instead of rehashing everything at once.',
+        timeComplexity: { best: 'O(1)', average: 'O(1)', worst: 'O(n)' },
+        spaceComplexity: 'O(n)',
+        howItWorks: [
+            '1. When the table is full, a bucket array twice the size is allocated',
+            '2. Old and new arrays stay live while the resize runs',
+            '3. Every insert and search moves up to 8 old buckets into the new array',
+            '4. Lookups check the new array and any old bucket not yet migrated',
+            '5. The old array is freed once its last bucket has moved'
+        ],
+        useCase: 'Latency-sensitive services where a stop-the-world resize would blow the p99 budget'
+    },
+    'hash_functions': {
+        title: 'Hash Functions',
+        description: 'Selectable integer and string hash functions compared by how evenly they spread structured keys.',
+        timeComplexity: { best: 'O(1)', average: 'O(1)', worst: 'O(k) for k-byte strings' },
+        spaceComplexity: 'O(1)',
+        howItWorks: [
+            '1. Modulo keeps the low bits, so strided keys pile into a few buckets',
+            '2. Fibonacci hashing takes the top bits of key * 2^64/phi',
+            '3. The 64-bit mixer folds a 128-bit multiply so every input bit affects the index',
+            '4. The string hash mixes eight bytes per step the same way',
+            '5. The benchmark reports empty buckets, longest chain and probes per lookup'
+        ],
+        useCase: 'Choosing a hash for sequential IDs, strided keys or byte-string keys'
+    },
+    'bloom_filter': {
+        title: 'Blocked Bloom Filter',
+        description: 'Cache-line-sized Bloom filter kept in sync with a chaining hash table to answer most misses without walking a chain.',
+        timeComplexity: { best: 'O(1)', average: 'O(k)', worst: 'O(k)' },
+        spaceComplexity: 'O(n) bits',
+        howItWorks: [
+            '1. Size the filter from the expected key count and target false-positive rate',
+            '2. One hash picks a 512-bit block, the rest pick k bits inside it',
+            '3. Insert sets the key\'s bits alongside the chain insert',
+            '4. Search checks the block first; any clear bit means a definite miss',
+            '5. Counters record chain walks avoided and false positives'
+        ],
+        useCase: 'Lookup-heavy workloads where most searches are for keys that are not present'
+    },
+    'batched_hash_lookup': {
+        title: 'Batched Hash Lookups',
+        description: 'Looks up many keys at once, prefetching bucket heads and chain nodes so their cache misses overlap.',
+        timeComplexity: { best: 'O(1) per key', average: 'O(1) per key', worst: 'O(n) per key' },
+        spaceComplexity: 'O(1) beyond the output array',
+        howItWorks: [
+            '1. Split the batch into groups of 32 keys',
+            '2. Hash every key in the group and prefetch its bucket head',
+            '3. Load the heads and prefetch each first node',
+            '4. Advance all unfinished chains one node per round, prefetching the next',
+            '5. Write each value (or -1) to the output array'
+        ],
+        useCase: 'Join probes and bulk membership checks against tables larger than the CPU cache'
+    },
+    'persistent_hash_table': {
+        title: 'Persistent Hash Table (mmap)',
+        description: 'Serializes a chaining hash table into a flat, pointer-free file that can be memory-mapped and searched without loading.',
+        timeComplexity: { best: 'O(1)', average: 'O(1)', worst: 'O(n)' },
+        spaceComplexity: 'O(n) on disk',
+        howItWorks: [
+            '1. Each chain is written as a contiguous run of (key, value) entries',
+            '2. A bucket offset array marks where each run starts and ends',
+            '3. A header stores magic, version, sizes and a checksum',
+            '4. Opening maps the file read-only and validates the header',
+            '5. Search hashes the key and scans its run straight from the mapping'
+        ],
+        useCase: 'Lookup tables that must be queryable instantly at process start'
+    },
+    'lru_cache': {
+        title: 'LRU Cache',
+        description: 'Bounded cache combining a doubly linked recency list with a hash table, all stored in one node pool with index links.',
+        timeComplexity: { best: 'O(1)', average: 'O(1)', worst: 'O(1) expected' },
+        spaceComplexity: 'O(capacity)',
+        howItWorks: [
+            '1. Nodes live in one array and link by index instead of pointer',
+            '2. prev/next links keep nodes in recency order, newest at the head',
+            '3. A hash chain per bucket finds a key\'s node in O(1)',
+            '4. Get moves the node to the head; put adds or updates at the head',
+            '5. When full, the tail node is evicted and its slot reused',
+            '6. The sharded variant splits keys over independently locked caches'
+        ],
+        useCase: 'Page caches, memoization and any bounded key-value cache with recency-based eviction'
     }
 }
 